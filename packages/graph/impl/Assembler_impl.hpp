@@ -6,33 +6,40 @@
 
 // --- FEM Includes ---
 #include "packages/graph/inc/Assembler.hpp"
+#include "packages/numeric/inc/DirichletConstraints.hpp"
 
 // --- Utility Includes ---
 #include "packages/macros/inc/exceptions.hpp"
 #include "packages/macros/inc/checks.hpp"
-#include "packages/concurrency/inc/Mutex.hpp"
 #include "packages/concurrency/inc/ParallelFor.hpp"
 
 // --- STL Includes ---
 #include <queue>
-#include <algorithm> // lower_bound, sort, unique
+#include <algorithm> // lower_bound, sort, unique, copy, shift_right
 #include <numeric> // inclusive_scan
+#include <atomic> // atomic, atomic_ref
+#include <exception> // exception_ptr
+#include <utility> // forward
 
 
 namespace cie::fem {
 
 
+template <concepts::UnsignedInteger TDoFIndex>
 template <class TVertexData,
           class TEdgeData,
           class TGraphData,
           concepts::FunctionWithSignature<std::size_t,Ref<const typename Graph<TVertexData,TEdgeData,TGraphData>::Vertex>> TDoFCounter,
-          concepts::FunctionWithSignature<void,Ref<const typename Graph<TVertexData,TEdgeData,TGraphData>::Edge>,Assembler::DoFPairIterator> TDoFPairFunctor>
-void Assembler::addGraph(Ref<const Graph<TVertexData,TEdgeData,TGraphData>> rGraph,
-                         TDoFCounter&& rDoFCounter,
-                         TDoFPairFunctor&& rDoFMatcher)
+          concepts::FunctionWithSignature<void,Ref<const typename Graph<TVertexData,TEdgeData,TGraphData>::Edge>,typename BasicAssembler<TDoFIndex>::DoFPairIterator> TDoFPairFunctor>
+void BasicAssembler<TDoFIndex>::addGraph(Ref<const Graph<TVertexData,TEdgeData,TGraphData>> rGraph,
+                                         TDoFCounter&& rDoFCounter,
+                                         TDoFPairFunctor&& rDoFMatcher,
+                                         OptionalRef<mp::ThreadPoolBase> rThreadPool)
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
+    CIE_CHECK(_constrainedDoFCount == 0ul, "Cannot add cells to a condensed assembler")
+
     // Early exit if the graph is empty
     if (rGraph.empty()) {
         return;
@@ -41,193 +48,939 @@ void Assembler::addGraph(Ref<const Graph<TVertexData,TEdgeData,TGraphData>> rGra
     using Vertex = typename Graph<TVertexData,TEdgeData,TGraphData>::Vertex;
     using Edge = typename Graph<TVertexData,TEdgeData,TGraphData>::Edge;
 
-    std::queue<Ptr<const Vertex>> visitQueue {{&rGraph.vertices().front()}};
+    // Register all cells up front, so that their DoF ranges
+    // can be laid out contiguously before any DoF is assigned.
+    for (Ref<const Vertex> rVertex : rGraph.vertices()) {
+        const std::size_t localDoFCount = rDoFCounter(rVertex);
+        const auto [itCell, isNew] = _cellIndices.emplace(rVertex.id(), _cellIDs.size());
+        if (isNew) {
+            _cellIDs.push_back(rVertex.id());
+            _dofExtents.push_back(_dofExtents.back() + localDoFCount);
+        } else {
+            CIE_CHECK(
+                this->getDoFs(itCell->second).size() == localDoFCount,
+                "Vertex " << rVertex.id() << " was previously registered with " << this->getDoFs(itCell->second).size()
+                << " DoFs, but now has " << localDoFCount
+            )
+        }
+    } // for rVertex in rGraph.vertices()
+    _dofIndices.resize(_dofExtents.back(), _invalidDoF);
+
+    if (rThreadPool.has_value() && 1 < rThreadPool.value().size()) {
+        DynamicArray<Ptr<const Edge>> edges;
+        edges.reserve(rGraph.edges().size());
+        for (Ref<const Edge> rEdge : rGraph.edges()) edges.push_back(&rEdge);
+        this->numberDoFs(std::span<const Ptr<const Edge>>(edges),
+                         rDoFMatcher,
+                         rThreadPool.value());
+        return;
+    }
+
+    std::queue<Ptr<const Vertex>> visitQueue;
     tsl::robin_set<typename Vertex::ID> visited;
     DoFPairVector dofPairs;
 
-    while (!visitQueue.empty()) {
-        // Strip the next vertex to visit
-        Ref<const Vertex> rVertex = *visitQueue.front();
-        visited.insert(rVertex.id());
-        visitQueue.pop();
+    // Traverse each connected component of the graph
+    for (Ref<const Vertex> rRoot : rGraph.vertices()) {
+        if (!visited.insert(rRoot.id()).second) {
+            continue;
+        }
+        visitQueue.push(&rRoot);
 
-        // Insert the vertex to handle disconnected cells.
-        _dofMap.emplace(rVertex.id(), DoFMap::mapped_type {}).first->second.resize(rDoFCounter(rVertex));
+        while (!visitQueue.empty()) {
+            // Strip the next vertex to visit
+            Ref<const Vertex> rVertex = *visitQueue.front();
+            visitQueue.pop();
 
-        for (const auto edgeID : rVertex.edges()) {
-            Ref<const Edge> rEdge = rGraph.find(edgeID).value();
+            for (const auto edgeID : rVertex.edges()) {
+                Ref<const Edge> rEdge = rGraph.find(edgeID).value();
 
-            Ptr<const Vertex> pSource, pTarget;
-            if (rEdge.source() == rVertex.id()) {
-                pSource = &rVertex;
-                pTarget = &rGraph.find(rEdge.target()).value();
-                if (visited.emplace(rEdge.target()).second) {
-                    visitQueue.push(pTarget);
-                }
-            } else {
-                pSource = &rGraph.find(rEdge.source()).value();
-                pTarget = &rVertex;
-                if (visited.emplace(rEdge.source()).second) {
-                    visitQueue.push(pSource);
+                if (rEdge.source() == rVertex.id()) {
+                    if (visited.emplace(rEdge.target()).second) {
+                        visitQueue.push(&rGraph.find(rEdge.target()).value());
+                    }
+                } else {
+                    if (visited.emplace(rEdge.source()).second) {
+                        visitQueue.push(&rGraph.find(rEdge.source()).value());
+                    }
                 }
-            }
 
-            Ref<const Vertex> rSource = *pSource;
-            Ref<const Vertex> rTarget = *pTarget;
+                // Get DoF ranges
+                const std::span<DoFIndex> sourceDoFs = this->getMutableDoFs(this->getCellIndex(rEdge.source()));
+                const std::span<DoFIndex> targetDoFs = this->getMutableDoFs(this->getCellIndex(rEdge.target()));
+
+                // Get DoF connectivities
+                dofPairs.clear();
+                rDoFMatcher(rEdge, std::back_inserter(dofPairs));
+
+                // Assign DoFs
+                for (auto dofPair : dofPairs) {
+                    CIE_OUT_OF_RANGE_CHECK(dofPair.first < sourceDoFs.size())
+                    CIE_OUT_OF_RANGE_CHECK(dofPair.second < targetDoFs.size())
+                    DoFIndex& rSourceDoF = sourceDoFs[dofPair.first];
+                    DoFIndex& rTargetDoF = targetDoFs[dofPair.second];
+
+                    if (rSourceDoF != _invalidDoF) {
+                        if (rTargetDoF != _invalidDoF) {
+                            CIE_CHECK(
+                                rSourceDoF == rTargetDoF,
+                                "DoF assignment failure at edge " << rEdge.id()
+                                << " between vertex " << rEdge.source() << " (local DoF " << dofPair.first << " assigned to global DoF " << rSourceDoF << ")"
+                                << " and vertex " << rEdge.target() << " (local DoF " << dofPair.second << " assigned to global DoF " << rTargetDoF << ")"
+                            );
+                        } else {
+                            rTargetDoF = rSourceDoF;
+                        }
+                    } else if (rTargetDoF != _invalidDoF) {
+                        rSourceDoF = rTargetDoF;
+                    } else {
+                        CIE_CHECK(_dofCounter < _invalidDoF, "DoF index type overflow")
+                        const auto iDoF = static_cast<DoFIndex>(_dofCounter++);
+                        rSourceDoF = iDoF;
+                        rTargetDoF = iDoF;
+                    }
+                } // for dofPair in dofPairs
+            } // for rEdge in rVertex.edges()
+        } // while visitQueue
+    } // for rRoot in rGraph.vertices()
+
+    for (auto& riDoF : _dofIndices) {
+        if (riDoF == _invalidDoF) {
+            CIE_CHECK(_dofCounter < _invalidDoF, "DoF index type overflow")
+            riDoF = static_cast<DoFIndex>(_dofCounter++);
+        }
+    }
+
+    CIE_END_EXCEPTION_TRACING
+}
+
 
-            // Get DoF containers
-            Ref<DoFMap::mapped_type> rSourceDoFs = _dofMap.emplace(rEdge.source(), DoFMap::mapped_type {}).first->second;
-            Ref<DoFMap::mapped_type> rTargetDoFs = _dofMap.emplace(rEdge.target(), DoFMap::mapped_type {}).first->second;
-            rSourceDoFs.resize(rDoFCounter(rSource));
-            rTargetDoFs.resize(rDoFCounter(rTarget));
+template <concepts::UnsignedInteger TDoFIndex>
+template <class TEdge, class TDoFPairFunctor>
+void BasicAssembler<TDoFIndex>::numberDoFs(std::span<const Ptr<const TEdge>> edges,
+                                           TDoFPairFunctor&& rDoFMatcher,
+                                           Ref<mp::ThreadPoolBase> rThreadPool)
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    // Split a range of items into one chunk per thread and process the chunks in parallel.
+    // Exceptions are caught within the chunks and the first one is rethrown afterwards.
+    const std::size_t threadCount = rThreadPool.size();
+    const auto forEachChunk = [threadCount, &rThreadPool](std::size_t itemCount, auto&& rJob) -> void {
+        DynamicArray<std::exception_ptr> exceptions(threadCount);
+        mp::ParallelFor<> loop(rThreadPool);
+        loop(threadCount, [&](std::size_t iChunk) -> void {
+            try {
+                rJob(iChunk,
+                     iChunk * itemCount / threadCount,
+                     (iChunk + 1) * itemCount / threadCount);
+            } catch (...) {
+                exceptions[iChunk] = std::current_exception();
+            }
+        });
+        for (const auto& rpException : exceptions) {
+            if (rpException) std::rethrow_exception(rpException);
+        }
+    };
+
+    // Every DoF slot of every cell starts out in its own equivalence class
+    const std::size_t slotCount = _dofIndices.size();
+    DynamicArray<std::atomic<std::size_t>> parents(slotCount);
+    forEachChunk(slotCount, [&parents](std::size_t, std::size_t iBegin, std::size_t iEnd) {
+        for (std::size_t iSlot=iBegin; iSlot<iEnd; ++iSlot) parents[iSlot].store(iSlot, std::memory_order_relaxed);
+    });
+
+    // Find the root of a slot's class, halving the path along the way
+    const auto find = [&parents](std::size_t iSlot) -> std::size_t {
+        while (true) {
+            std::size_t iParent = parents[iSlot].load(std::memory_order_acquire);
+            if (iParent == iSlot) return iSlot;
+            const std::size_t iGrandParent = parents[iParent].load(std::memory_order_acquire);
+            if (iParent != iGrandParent) {
+                parents[iSlot].compare_exchange_weak(iParent, iGrandParent, std::memory_order_acq_rel);
+            }
+            iSlot = iGrandParent;
+        }
+    };
+
+    // Merge two classes by linking the larger root to the smaller one.
+    // Parents always precede their children, so the root of each class
+    // is its first slot and no cycles can form.
+    const auto merge = [&parents, &find](std::size_t iLeft, std::size_t iRight) -> void {
+        while (true) {
+            iLeft = find(iLeft);
+            iRight = find(iRight);
+            if (iLeft == iRight) return;
+            if (iLeft < iRight) std::swap(iLeft, iRight);
+            std::size_t expected = iLeft;
+            if (parents[iLeft].compare_exchange_strong(expected, iRight, std::memory_order_acq_rel)) return;
+        }
+    };
+
+    // Match the DoFs on all edges in parallel
+    forEachChunk(edges.size(), [this, &edges, &rDoFMatcher, &merge](std::size_t, std::size_t iBegin, std::size_t iEnd) {
+        DoFPairVector dofPairs;
+        for (std::size_t iEdge=iBegin; iEdge<iEnd; ++iEdge) {
+            const auto& rEdge = *edges[iEdge];
+            const std::size_t iSourceCell = this->getCellIndex(rEdge.source());
+            const std::size_t iTargetCell = this->getCellIndex(rEdge.target());
+            const std::size_t sourceSize = _dofExtents[iSourceCell + 1] - _dofExtents[iSourceCell];
+            const std::size_t targetSize = _dofExtents[iTargetCell + 1] - _dofExtents[iTargetCell];
 
-            // Get DoF connectivities
             dofPairs.clear();
             rDoFMatcher(rEdge, std::back_inserter(dofPairs));
 
-            // Assign DoFs
-            for (auto dofPair : dofPairs) {
-                auto& rMaybeSourceDoF = rSourceDoFs[dofPair.first];
-                auto& rMaybeTargetDoF = rTargetDoFs[dofPair.second];
-
-                if (rMaybeSourceDoF.has_value()) {
-                    if (rMaybeTargetDoF.has_value()) {
-                        CIE_CHECK(
-                            *rMaybeSourceDoF == *rMaybeTargetDoF,
-                            "DoF assignment failure at edge " << rEdge.id()
-                            << " between vertex " << rEdge.source() << " (local DoF " << dofPair.first << " assigned to global DoF " << *rMaybeSourceDoF << ")"
-                            << " and vertex " << rEdge.target() << " (local DoF " << dofPair.second << " assigned to global DoF " << *rMaybeTargetDoF << ")"
-                        );
-                    } else {
-                        rMaybeTargetDoF = rMaybeSourceDoF;
-                    }
-                } else if (rMaybeTargetDoF.has_value()) {
-                    rMaybeSourceDoF = rMaybeTargetDoF;
-                } else {
-                    const auto iDoF = _dofCounter++;
-                    rMaybeSourceDoF = iDoF;
-                    rMaybeTargetDoF = iDoF;
-                }
-            } // for dofPair in dofPairs
-        } // for rEdge in rVertex.edges()
-    } // while visitQueue
+            for (const auto& rDoFPair : dofPairs) {
+                CIE_OUT_OF_RANGE_CHECK(rDoFPair.first < sourceSize)
+                CIE_OUT_OF_RANGE_CHECK(rDoFPair.second < targetSize)
+                merge(_dofExtents[iSourceCell] + rDoFPair.first,
+                      _dofExtents[iTargetCell] + rDoFPair.second);
+            }
+        } // for iEdge in range(iBegin, iEnd)
+    });
+
+    // Flatten the classes
+    DynamicArray<std::size_t> roots(slotCount);
+    forEachChunk(slotCount, [&roots, &find](std::size_t, std::size_t iBegin, std::size_t iEnd) {
+        for (std::size_t iSlot=iBegin; iSlot<iEnd; ++iSlot) roots[iSlot] = find(iSlot);
+    });
+
+    // A cell whose local DoFs share a class has been matched inconsistently
+    const std::size_t cellCount = this->cellCount();
+    forEachChunk(cellCount, [this, &roots](std::size_t, std::size_t iBegin, std::size_t iEnd) {
+        DynamicArray<std::pair<std::size_t,std::size_t>> cellRoots;
+        for (std::size_t iCell=iBegin; iCell<iEnd; ++iCell) {
+            cellRoots.clear();
+            for (std::size_t iSlot=_dofExtents[iCell]; iSlot<_dofExtents[iCell + 1]; ++iSlot) {
+                cellRoots.emplace_back(roots[iSlot], iSlot - _dofExtents[iCell]);
+            }
+            std::sort(cellRoots.begin(), cellRoots.end());
+            const auto itDuplicate = std::adjacent_find(cellRoots.begin(),
+                                                        cellRoots.end(),
+                                                        [](const auto& rLeft, const auto& rRight) {
+                                                            return rLeft.first == rRight.first;
+                                                        });
+            CIE_CHECK(
+                itDuplicate == cellRoots.end(),
+                "DoF assignment failure at vertex " << _cellIDs[iCell]
+                << ": local DoFs " << itDuplicate->second << " and " << (itDuplicate + 1)->second
+                << " are matched to the same global DoF"
+            )
+        } // for iCell in range(iBegin, iEnd)
+    });
+
+    // Classes containing DoFs that were assigned by previous calls keep their index.
+    // Roots store the index of their class.
+    bool hasAssignedDoFs = false;
+    for (const DoFIndex iDoF : _dofIndices) {
+        if (iDoF != _invalidDoF) {
+            hasAssignedDoFs = true;
+            break;
+        }
+    }
 
-    for (auto& rPair : _dofMap)
-        for (auto& riDoF : rPair.second)
-            if (!riDoF.has_value())
-                riDoF = _dofCounter++;
+    if (hasAssignedDoFs) {
+        for (std::size_t iSlot=0ul; iSlot<slotCount; ++iSlot) {
+            const DoFIndex iDoF = _dofIndices[iSlot];
+            if (iDoF == _invalidDoF) continue;
+            DoFIndex& rRootDoF = _dofIndices[roots[iSlot]];
+            CIE_CHECK(
+                rRootDoF == _invalidDoF || rRootDoF == iDoF,
+                "DoF assignment failure: global DoFs " << rRootDoF << " and " << iDoF << " are matched to each other"
+            )
+            rRootDoF = iDoF;
+        }
+    }
+
+    // Number the remaining classes with a parallel prefix sum over the roots
+    DynamicArray<std::size_t> chunkOffsets(threadCount + 1, 0ul);
+    forEachChunk(slotCount, [this, &roots, &chunkOffsets](std::size_t iChunk, std::size_t iBegin, std::size_t iEnd) {
+        std::size_t newCount = 0ul;
+        for (std::size_t iSlot=iBegin; iSlot<iEnd; ++iSlot) {
+            if (roots[iSlot] == iSlot && _dofIndices[iSlot] == _invalidDoF) ++newCount;
+        }
+        chunkOffsets[iChunk + 1] = newCount;
+    });
+    std::inclusive_scan(chunkOffsets.begin(), chunkOffsets.end(), chunkOffsets.begin());
+    CIE_CHECK(_dofCounter + chunkOffsets.back() <= _invalidDoF, "DoF index type overflow")
+
+    forEachChunk(slotCount, [this, &roots, &chunkOffsets](std::size_t iChunk, std::size_t iBegin, std::size_t iEnd) {
+        std::size_t iDoF = _dofCounter + chunkOffsets[iChunk];
+        for (std::size_t iSlot=iBegin; iSlot<iEnd; ++iSlot) {
+            if (roots[iSlot] == iSlot && _dofIndices[iSlot] == _invalidDoF) {
+                _dofIndices[iSlot] = static_cast<DoFIndex>(iDoF++);
+            }
+        }
+    });
+    _dofCounter += chunkOffsets.back();
+
+    // Propagate the indices of the roots to the rest of their classes
+    forEachChunk(slotCount, [this, &roots](std::size_t, std::size_t iBegin, std::size_t iEnd) {
+        for (std::size_t iSlot=iBegin; iSlot<iEnd; ++iSlot) {
+            if (roots[iSlot] != iSlot) _dofIndices[iSlot] = _dofIndices[roots[iSlot]];
+        }
+    });
 
     CIE_END_EXCEPTION_TRACING
 }
 
 
-template <class TIndex, class TValue>
-void Assembler::makeCSRMatrix(Ref<TIndex> rRowCount,
-                              Ref<TIndex> rColumnCount,
-                              Ref<DynamicArray<TIndex>> rRowExtents,
-                              Ref<DynamicArray<TIndex>> rColumnIndices,
-                              Ref<DynamicArray<TValue>> rNonzeros,
-                              OptionalRef<mp::ThreadPoolBase> rThreadPool) const
+template <concepts::UnsignedInteger TDoFIndex>
+template <class TValue>
+std::size_t BasicAssembler<TDoFIndex>::condense(Ref<const DirichletConstraints<TValue>> rConstraints,
+                                                Ref<DynamicArray<TValue>> rConstrainedValues)
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    CIE_CHECK(_constrainedDoFCount == 0ul, "The assembler is already condensed")
+    CIE_CHECK(
+        rConstraints.dofCount() == _dofCounter,
+        "Constraints are defined on " << rConstraints.dofCount() << " DoFs, but the assembler has " << _dofCounter
+    )
+
+    // Stable partition of DoF indices into free and constrained ones
+    const std::size_t freeDoFCount = _dofCounter - rConstraints.size();
+    DynamicArray<TDoFIndex> newIndices(_dofCounter);
+    rConstrainedValues.resize(rConstraints.size());
+    std::size_t iFree = 0ul, iConstrained = freeDoFCount;
+
+    for (std::size_t iDoF=0ul; iDoF<_dofCounter; ++iDoF) {
+        if (rConstraints.isConstrained(iDoF)) {
+            rConstrainedValues[iConstrained - freeDoFCount] = rConstraints.getValue(iDoF);
+            newIndices[iDoF] = static_cast<TDoFIndex>(iConstrained++);
+        } else {
+            newIndices[iDoF] = static_cast<TDoFIndex>(iFree++);
+        }
+    } // for iDoF in range(dofCount)
+
+    for (TDoFIndex& riDoF : _dofIndices) riDoF = newIndices[riDoF];
+    _constrainedDoFCount = rConstraints.size();
+    return freeDoFCount;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+template <class TValue>
+void BasicAssembler<TDoFIndex>::expand(Ptr<const TValue> pReducedVector,
+                                       Ref<const DynamicArray<TValue>> rConstrainedValues,
+                                       Ptr<TValue> pVector) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    CIE_OUT_OF_RANGE_CHECK(rConstrainedValues.size() == _constrainedDoFCount)
+    const std::size_t freeDoFCount = this->freeDoFCount();
+    std::copy(pReducedVector, pReducedVector + freeDoFCount, pVector);
+    std::copy(rConstrainedValues.begin(), rConstrainedValues.end(), pVector + freeDoFCount);
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+template <class TIndex>
+void BasicAssembler<TDoFIndex>::makeSparsityPattern(Ref<DynamicArray<TIndex>> rRowExtents,
+                                                    Ref<DynamicArray<TIndex>> rColumnIndices,
+                                                    bool upperTriangle,
+                                                    OptionalRef<mp::ThreadPoolBase> rThreadPool) const
 {
     CIE_BEGIN_EXCEPTION_TRACING
 
-    // Initialize matrix containers
     rRowExtents.clear();
     rColumnIndices.clear();
+
+    // Constrained DoFs are numbered after all free ones
+    // and are excluded from both rows and columns.
+    const std::size_t rowCount = this->freeDoFCount();
+
+    const std::size_t threadCount = rThreadPool.has_value() ? rThreadPool.value().size() : 1;
+    const auto forEach = [threadCount, &rThreadPool](std::size_t count, auto&& rJob) -> void {
+        if (threadCount < 2 || count < 2) {
+            for (std::size_t i=0ul; i<count; ++i) rJob(i);
+        } else {
+            mp::ParallelFor<>(rThreadPool.value())(count, rJob);
+        }
+    };
+
+    // Build the DoF => cell incidence in two passes over contiguous chunks of cells:
+    // count the cells each DoF appears in, then fill the cell indices at offsets given
+    // by a prefix sum. Counts and slots are claimed atomically, so no per-chunk arrays are
+    // necessary, at the cost of an unordered incidence (columns get sorted later anyway).
+    const std::size_t cellCount = this->cellCount();
+    const std::size_t cellChunkCount = std::max<std::size_t>(std::min(threadCount, cellCount), 1ul);
+    const auto getCellChunkBegin = [cellCount, cellChunkCount](std::size_t iChunk) -> std::size_t {
+        return iChunk * cellCount / cellChunkCount;
+    };
+
+    DynamicArray<std::size_t> incidenceExtents(rowCount + 1, 0ul);
+    forEach(cellChunkCount, [this, rowCount, &incidenceExtents, &getCellChunkBegin](std::size_t iChunk) -> void {
+        for (std::size_t iCell=getCellChunkBegin(iChunk); iCell<getCellChunkBegin(iChunk + 1); ++iCell) {
+            for (const DoFIndex iDoF : this->getDoFs(iCell)) {
+                CIE_OUT_OF_RANGE_CHECK(iDoF < _dofCounter)
+                if (iDoF < rowCount) std::atomic_ref<std::size_t>(incidenceExtents[iDoF + 1]).fetch_add(1ul, std::memory_order_relaxed);
+            }
+        }
+    });
+    std::inclusive_scan(incidenceExtents.begin(), incidenceExtents.end(), incidenceExtents.begin());
+
+    DynamicArray<std::size_t> incidence(incidenceExtents.back());
+    forEach(cellChunkCount, [this, rowCount, &incidenceExtents, &incidence, &getCellChunkBegin](std::size_t iChunk) -> void {
+        for (std::size_t iCell=getCellChunkBegin(iChunk); iCell<getCellChunkBegin(iChunk + 1); ++iCell) {
+            for (const DoFIndex iDoF : this->getDoFs(iCell)) {
+                if (iDoF < rowCount) {
+                    incidence[std::atomic_ref<std::size_t>(incidenceExtents[iDoF]).fetch_add(1ul, std::memory_order_relaxed)] = iCell;
+                }
+            }
+        }
+    });
+
+    // Claiming slots advanced the begin of each DoF's incidence to its end,
+    // which is the begin of the next one.
+    std::shift_right(incidenceExtents.begin(), incidenceExtents.end(), 1);
+    incidenceExtents.front() = 0ul;
+
+    // Columns of a row are collected from the cells it appears in, then sorted and deduplicated
+    // in scratch space private to each chunk of rows. Rows are collected twice: once to count their
+    // unique columns, and once to write them into the exactly sized array of column indices,
+    // so no other array as large as the matrix is ever allocated.
+    const auto collectColumns = [this, upperTriangle, rowCount, &incidenceExtents, &incidence](std::size_t iRow,
+                                                                                              Ref<DynamicArray<TIndex>> rColumns) -> void {
+        rColumns.clear();
+        for (std::size_t iIncidence=incidenceExtents[iRow]; iIncidence<incidenceExtents[iRow + 1]; ++iIncidence) {
+            for (const DoFIndex iDoF : this->getDoFs(incidence[iIncidence])) {
+                if (iDoF < rowCount && (!upperTriangle || iRow <= iDoF)) rColumns.push_back(static_cast<TIndex>(iDoF));
+            }
+        }
+        std::sort(rColumns.begin(), rColumns.end());
+        rColumns.erase(std::unique(rColumns.begin(), rColumns.end()), rColumns.end());
+    };
+
+    const std::size_t rowChunkCount = threadCount < 2 ? 1ul : std::min(4 * threadCount, std::max(rowCount, 1ul));
+    const auto getRowChunkBegin = [rowCount, rowChunkCount](std::size_t iChunk) -> std::size_t {
+        return iChunk * rowCount / rowChunkCount;
+    };
+
+    rRowExtents.resize(rowCount + 1);
+    rRowExtents.front() = 0;
+    forEach(rowChunkCount, [&collectColumns, &rRowExtents, &getRowChunkBegin](std::size_t iChunk) -> void {
+        DynamicArray<TIndex> columns;
+        for (std::size_t iRow=getRowChunkBegin(iChunk); iRow<getRowChunkBegin(iChunk + 1); ++iRow) {
+            collectColumns(iRow, columns);
+
+            // Temporarily store the number of unique column indices in the row
+            rRowExtents[iRow + 1] = static_cast<TIndex>(columns.size());
+        }
+    });
+    std::inclusive_scan(rRowExtents.begin(), rRowExtents.end(), rRowExtents.begin());
+
+    // Replace rather than resize, so the matrix does not hold on to previous capacity
+    rColumnIndices = DynamicArray<TIndex>(rRowExtents.back());
+    forEach(rowChunkCount, [&collectColumns, &rRowExtents, &rColumnIndices, &getRowChunkBegin](std::size_t iChunk) -> void {
+        DynamicArray<TIndex> columns;
+        for (std::size_t iRow=getRowChunkBegin(iChunk); iRow<getRowChunkBegin(iChunk + 1); ++iRow) {
+            collectColumns(iRow, columns);
+            std::copy(columns.begin(), columns.end(), rColumnIndices.begin() + rRowExtents[iRow]);
+        }
+    });
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+template <class TIndex, class TValue>
+void BasicAssembler<TDoFIndex>::makeCSRMatrix(Ref<TIndex> rRowCount,
+                                              Ref<TIndex> rColumnCount,
+                                              Ref<DynamicArray<TIndex>> rRowExtents,
+                                              Ref<DynamicArray<TIndex>> rColumnIndices,
+                                              Ref<DynamicArray<TValue>> rNonzeros,
+                                              OptionalRef<mp::ThreadPoolBase> rThreadPool) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
     rNonzeros.clear();
+    rRowCount = static_cast<TIndex>(this->freeDoFCount());
+    rColumnCount = rRowCount;
+    this->makeSparsityPattern(rRowExtents, rColumnIndices, false, rThreadPool);
+    rNonzeros.resize(rRowExtents.back());
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+template <class TIndex, class TValue>
+void BasicAssembler<TDoFIndex>::makeSymmetricCSRMatrix(Ref<TIndex> rRowCount,
+                                                       Ref<TIndex> rColumnCount,
+                                                       Ref<DynamicArray<TIndex>> rRowExtents,
+                                                       Ref<DynamicArray<TIndex>> rColumnIndices,
+                                                       Ref<DynamicArray<TValue>> rNonzeros,
+                                                       OptionalRef<mp::ThreadPoolBase> rThreadPool) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    rNonzeros.clear();
+    rRowCount = static_cast<TIndex>(this->freeDoFCount());
+    rColumnCount = rRowCount;
+    this->makeSparsityPattern(rRowExtents, rColumnIndices, true, rThreadPool);
+    rNonzeros.resize(rRowExtents.back());
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+template <class TIndex, class TValue>
+void BasicAssembler<TDoFIndex>::makeBSRMatrix(Ref<TIndex> rRowCount,
+                                              Ref<TIndex> rColumnCount,
+                                              Ref<DynamicArray<TIndex>> rRowExtents,
+                                              Ref<DynamicArray<TIndex>> rColumnIndices,
+                                              Ref<DynamicArray<TValue>> rNonzeros,
+                                              OptionalRef<mp::ThreadPoolBase> rThreadPool) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    rNonzeros.clear();
+    rRowCount = static_cast<TIndex>(this->freeDoFCount());
+    rColumnCount = rRowCount;
+    this->makeSparsityPattern(rRowExtents, rColumnIndices, false, rThreadPool);
+    rNonzeros.resize(rRowExtents.back() * _componentCount * _componentCount);
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+template <bool UpperTriangle, class TIndex, class TFunctor>
+void BasicAssembler<TDoFIndex>::forEachNonzero(std::span<const DoFIndex> dofs,
+                                               Ref<const DynamicArray<TIndex>> rRowExtents,
+                                               Ref<const DynamicArray<TIndex>> rColumnIndices,
+                                               TFunctor&& rFunctor) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
 
-    const TIndex rowCount = this->dofCount();
-    rRowCount = rowCount;
-    rColumnCount = rowCount;
-
-    // Initialize mutexes
-    // Each mutex is assigned a range of row indices it provides access to
-    const TIndex threadCount = rThreadPool.has_value() ? rThreadPool.value().size() : 1;
-    const TIndex minRowsPerMutex = rowCount / threadCount;
-    const TIndex leftoverRowCount = rowCount % threadCount;
-    DynamicArray<TIndex> mutexExtents;
-    DynamicArray<mp::Mutex<tags::SMP>> mutexes(threadCount);
-
-    mutexExtents.reserve(threadCount + 1);
-    for (TIndex iThread=0; iThread<threadCount; ++iThread) {
-        mutexExtents.push_back(mutexExtents.empty() ? 0 : mutexExtents.back()
-                               + minRowsPerMutex
-                               + (iThread < leftoverRowCount ? 1 : 0));
+    const std::size_t localSize = dofs.size();
+    const std::size_t freeDoFCount = this->freeDoFCount();
+
+    // Sort the local indices of the cell's free DoFs by their global index,
+    // so that the column indices of each CSR row can be swept in a single pass.
+    // Typical cells fit into a buffer on the stack, larger ones reuse storage
+    // private to the thread, so no allocation happens per cell.
+    StaticArray<std::size_t,_stackDoFCount> stackBuffer;
+    std::span<std::size_t> buffer(stackBuffer);
+    if (_stackDoFCount < localSize) {
+        static thread_local DynamicArray<std::size_t> threadBuffer;
+        if (threadBuffer.size() < localSize) threadBuffer.resize(localSize);
+        buffer = threadBuffer;
     }
-    mutexExtents.push_back(rowCount);
-
-    // Insert column indices into temporary row container
-    DynamicArray<DynamicArray<TIndex>> columnIndices(rowCount);
-
-    {
-        const auto job = [&columnIndices, &mutexExtents, &mutexes](const auto& rIndices) -> void {
-            for (const auto iRow : rIndices) {
-                // Find which thread the row belongs to.
-                const auto itMutexExtent = std::max(
-                    mutexExtents.begin(),
-                    std::lower_bound(mutexExtents.begin(),
-                                    mutexExtents.end(),
-                                    iRow) - 1
-                );
-                CIE_OUT_OF_RANGE_CHECK(itMutexExtent < mutexExtents.end());
-                auto& rMutex = mutexes[std::distance(mutexExtents.begin(), itMutexExtent)];
-
-                std::scoped_lock<mp::Mutex<tags::SMP>> lock(rMutex);
-                CIE_OUT_OF_RANGE_CHECK(iRow < columnIndices.size());
-                columnIndices[iRow].insert(columnIndices[iRow].end(), rIndices.begin(), rIndices.end());
-            } // for iRow in rIndices
-        };
 
-        if (threadCount < 2) {
-            for (const auto& rDofIndices : this->values()) job(rDofIndices);
-        } else {
-            const auto& rDofIndexContainers = this->values();
-            mp::ParallelFor<>(rThreadPool.value())(rDofIndexContainers.begin(),
-                                                   rDofIndexContainers.end(),
-                                                   job);
+    std::size_t freeLocalCount = 0ul;
+    for (std::size_t iLocal=0ul; iLocal<localSize; ++iLocal) {
+        if (dofs[iLocal] < freeDoFCount) buffer[freeLocalCount++] = iLocal;
+    }
+    const auto sortedDoFs = buffer.first(freeLocalCount);
+    std::sort(sortedDoFs.begin(),
+              sortedDoFs.end(),
+              [&dofs](std::size_t iLeft, std::size_t iRight) {return dofs[iLeft] < dofs[iRight];});
+
+    for (std::size_t iLocalRow=0ul; iLocalRow<localSize; ++iLocalRow) {
+        if (freeDoFCount <= dofs[iLocalRow]) continue;
+        const TIndex iRow = static_cast<TIndex>(dofs[iLocalRow]);
+        CIE_OUT_OF_RANGE_CHECK(iRow + 1 < static_cast<TIndex>(rRowExtents.size()))
+        const auto itColumnBegin = rColumnIndices.begin();
+        auto itColumn = itColumnBegin + rRowExtents[iRow];
+        const auto itColumnEnd = itColumnBegin + rRowExtents[iRow + 1];
+
+        for (const std::size_t iLocalColumn : sortedDoFs) {
+            const TIndex iColumn = static_cast<TIndex>(dofs[iLocalColumn]);
+            if constexpr (UpperTriangle) {
+                if (iColumn < iRow) continue;
+            }
+            while (itColumn != itColumnEnd && *itColumn < iColumn) ++itColumn;
+            CIE_OUT_OF_RANGE_CHECK(
+                itColumn != itColumnEnd && *itColumn == iColumn,
+                "column " << iColumn << " is missing from row " << iRow << " of the sparsity pattern"
+            )
+            rFunctor(iLocalRow * localSize + iLocalColumn,
+                     static_cast<TIndex>(std::distance(itColumnBegin, itColumn)));
+        } // for iLocalColumn in sortedDoFs
+    } // for iLocalRow in range(localSize)
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+template <class TIndex, class TValue>
+void BasicAssembler<TDoFIndex>::makeCSRMatrix(Ref<TIndex> rRowCount,
+                                              Ref<TIndex> rColumnCount,
+                                              Ref<DynamicArray<TIndex>> rRowExtents,
+                                              Ref<DynamicArray<TIndex>> rColumnIndices,
+                                              Ref<DynamicArray<TValue>> rNonzeros,
+                                              Ref<SlotMap<TIndex>> rSlotMap,
+                                              OptionalRef<mp::ThreadPoolBase> rThreadPool) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    this->makeCSRMatrix(rRowCount,
+                        rColumnCount,
+                        rRowExtents,
+                        rColumnIndices,
+                        rNonzeros,
+                        rThreadPool);
+    this->template makeSlotMap<false>(rRowExtents,
+                                      rColumnIndices,
+                                      rSlotMap,
+                                      rThreadPool);
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+template <class TIndex, class TValue>
+void BasicAssembler<TDoFIndex>::makeSymmetricCSRMatrix(Ref<TIndex> rRowCount,
+                                                       Ref<TIndex> rColumnCount,
+                                                       Ref<DynamicArray<TIndex>> rRowExtents,
+                                                       Ref<DynamicArray<TIndex>> rColumnIndices,
+                                                       Ref<DynamicArray<TValue>> rNonzeros,
+                                                       Ref<SlotMap<TIndex>> rSlotMap,
+                                                       OptionalRef<mp::ThreadPoolBase> rThreadPool) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    this->makeSymmetricCSRMatrix(rRowCount,
+                                 rColumnCount,
+                                 rRowExtents,
+                                 rColumnIndices,
+                                 rNonzeros,
+                                 rThreadPool);
+    this->template makeSlotMap<true>(rRowExtents,
+                                     rColumnIndices,
+                                     rSlotMap,
+                                     rThreadPool);
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+template <bool UpperTriangle, class TIndex>
+void BasicAssembler<TDoFIndex>::makeSlotMap(Ref<const DynamicArray<TIndex>> rRowExtents,
+                                            Ref<const DynamicArray<TIndex>> rColumnIndices,
+                                            Ref<SlotMap<TIndex>> rSlotMap,
+                                            OptionalRef<mp::ThreadPoolBase> rThreadPool) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    // Reserve a contiguous range of slots for each cell's local matrix
+    const std::size_t cellCount = this->cellCount();
+    rSlotMap.begins.resize(cellCount + 1);
+    rSlotMap.begins.front() = 0ul;
+    for (std::size_t iCell=0ul; iCell<cellCount; ++iCell) {
+        const std::size_t localSize = this->getDoFs(iCell).size();
+        rSlotMap.begins[iCell + 1] = rSlotMap.begins[iCell] + localSize * localSize;
+    }
+
+    // Entries in the lower triangle are not visited and keep the placeholder
+    rSlotMap.slots.assign(rSlotMap.begins.back(), SlotMap<TIndex>::skip);
+
+    // Fill each cell's range
+    const auto job = [this, &rSlotMap, &rRowExtents, &rColumnIndices](std::size_t iCell) -> void {
+        const Ptr<TIndex> pSlotBegin = rSlotMap.slots.data() + rSlotMap.begins[iCell];
+        this->template forEachNonzero<UpperTriangle>(this->getDoFs(iCell),
+                                                     rRowExtents,
+                                                     rColumnIndices,
+                                                     [pSlotBegin](std::size_t iLocalEntry, TIndex iNonzero) {
+                                                         pSlotBegin[iLocalEntry] = iNonzero;
+                                                     });
+    };
+
+    if (!rThreadPool.has_value() || rThreadPool.value().size() < 2) {
+        for (std::size_t iCell=0ul; iCell<cellCount; ++iCell) job(iCell);
+    } else {
+        mp::ParallelFor<>(rThreadPool.value())(cellCount, job);
+    }
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+template <class TIndex, class TValue>
+void BasicAssembler<TDoFIndex>::assemble(VertexID cellID,
+                                         Ptr<const TValue> pLocalMatrix,
+                                         Ref<const DynamicArray<TIndex>> rRowExtents,
+                                         Ref<const DynamicArray<TIndex>> rColumnIndices,
+                                         Ref<DynamicArray<TValue>> rNonzeros) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    this->template forEachNonzero<false>((*this)[cellID],
+                                         rRowExtents,
+                                         rColumnIndices,
+                                         [pLocalMatrix, &rNonzeros](std::size_t iLocalEntry, TIndex iNonzero) {
+                                             rNonzeros[iNonzero] += pLocalMatrix[iLocalEntry];
+                                         });
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+template <class TIndex, class TValue>
+void BasicAssembler<TDoFIndex>::assemble(VertexID cellID,
+                                         Ptr<const TValue> pLocalMatrix,
+                                         Ref<const DynamicArray<TIndex>> rRowExtents,
+                                         Ref<const DynamicArray<TIndex>> rColumnIndices,
+                                         Ref<DynamicArray<TValue>> rNonzeros,
+                                         Ref<const DynamicArray<TValue>> rConstrainedValues,
+                                         Ref<DynamicArray<TValue>> rRhs) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const auto dofs = (*this)[cellID];
+    this->assemble(cellID, pLocalMatrix, rRowExtents, rColumnIndices, rNonzeros);
+
+    // Lift the constrained columns of free rows to the right hand side
+    const std::size_t freeDoFCount = this->freeDoFCount();
+    const std::size_t localSize = dofs.size();
+    CIE_OUT_OF_RANGE_CHECK(rConstrainedValues.size() == _constrainedDoFCount)
+    for (std::size_t iLocalColumn=0ul; iLocalColumn<localSize; ++iLocalColumn) {
+        const DoFIndex iColumn = dofs[iLocalColumn];
+        if (iColumn < freeDoFCount) continue;
+        const TValue value = rConstrainedValues[iColumn - freeDoFCount];
+        for (std::size_t iLocalRow=0ul; iLocalRow<localSize; ++iLocalRow) {
+            const DoFIndex iRow = dofs[iLocalRow];
+            if (freeDoFCount <= iRow) continue;
+            CIE_OUT_OF_RANGE_CHECK(iRow < rRhs.size())
+            rRhs[iRow] -= pLocalMatrix[iLocalRow * localSize + iLocalColumn] * value;
         }
+    } // for iLocalColumn in range(localSize)
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+template <class TIndex, class TValue>
+void BasicAssembler<TDoFIndex>::assembleSymmetric(VertexID cellID,
+                                                  Ptr<const TValue> pLocalMatrix,
+                                                  Ref<const DynamicArray<TIndex>> rRowExtents,
+                                                  Ref<const DynamicArray<TIndex>> rColumnIndices,
+                                                  Ref<DynamicArray<TValue>> rNonzeros) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    this->template forEachNonzero<true>((*this)[cellID],
+                                        rRowExtents,
+                                        rColumnIndices,
+                                        [pLocalMatrix, &rNonzeros](std::size_t iLocalEntry, TIndex iNonzero) {
+                                            rNonzeros[iNonzero] += pLocalMatrix[iLocalEntry];
+                                        });
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+template <class TIndex, class TValue>
+void BasicAssembler<TDoFIndex>::assemble(VertexID cellID,
+                                         Ptr<const TValue> pLocalMatrix,
+                                         Ref<const SlotMap<TIndex>> rSlotMap,
+                                         Ref<DynamicArray<TValue>> rNonzeros) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const std::size_t iCell = this->getCellIndex(cellID);
+    CIE_OUT_OF_RANGE_CHECK(iCell + 1 < rSlotMap.begins.size())
+    const auto itSlotBegin = rSlotMap.slots.begin() + rSlotMap.begins[iCell];
+    const auto itSlotEnd = rSlotMap.slots.begin() + rSlotMap.begins[iCell + 1];
+
+    for (auto itSlot=itSlotBegin; itSlot!=itSlotEnd; ++itSlot, ++pLocalMatrix) {
+        if (*itSlot != SlotMap<TIndex>::skip) rNonzeros[*itSlot] += *pLocalMatrix;
     }
 
-    // Make column indices sorted and unique
-    {
-        const auto job = [] (Ref<DynamicArray<TIndex>> rIndices) {
-            std::sort(rIndices.begin(), rIndices.end());
-            rIndices.erase(std::unique(rIndices.begin(), rIndices.end()), rIndices.end());
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+template <class TIndex, class TValue, class TCellKernel>
+void BasicAssembler<TDoFIndex>::assemble(Ref<const Coloring> rColoring,
+                                         TCellKernel&& rCellKernel,
+                                         Ref<const SlotMap<TIndex>> rSlotMap,
+                                         Ref<DynamicArray<TValue>> rNonzeros,
+                                         OptionalRef<mp::ThreadPoolBase> rThreadPool) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+    DynamicArray<TValue> buffer;
+    this->assemble(rColoring,
+                   std::forward<TCellKernel>(rCellKernel),
+                   rSlotMap,
+                   rNonzeros,
+                   buffer,
+                   rThreadPool);
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+template <class TIndex, class TValue, class TCellKernel>
+void BasicAssembler<TDoFIndex>::assemble(Ref<const Coloring> rColoring,
+                                         TCellKernel&& rCellKernel,
+                                         Ref<const SlotMap<TIndex>> rSlotMap,
+                                         Ref<DynamicArray<TValue>> rNonzeros,
+                                         Ref<DynamicArray<TValue>> rBuffer,
+                                         OptionalRef<mp::ThreadPoolBase> rThreadPool) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const std::size_t threadCount = rThreadPool.has_value() ? rThreadPool.value().size() : 1;
+    CIE_OUT_OF_RANGE_CHECK(rSlotMap.begins.size() == this->cellCount() + 1)
+
+    // One local matrix per chunk, large enough for any colored cell
+    const std::size_t localCapacity = rColoring.maxLocalSize * rColoring.maxLocalSize;
+    if (rBuffer.size() < threadCount * localCapacity) rBuffer.resize(threadCount * localCapacity);
+
+    for (std::size_t iColor=0ul; iColor+1<rColoring.colorExtents.size(); ++iColor) {
+        const std::size_t iCellBegin = rColoring.colorExtents[iColor];
+        const std::size_t cellCount = rColoring.colorExtents[iColor + 1] - iCellBegin;
+        const std::size_t chunkCount = std::min(threadCount, cellCount);
+
+        const auto job = [&, iCellBegin, cellCount, chunkCount](std::size_t iChunk) -> void {
+            const Ptr<TValue> pLocalMatrix = rBuffer.data() + iChunk * localCapacity;
+            const std::size_t iChunkBegin = iCellBegin + iChunk * cellCount / chunkCount;
+            const std::size_t iChunkEnd = iCellBegin + (iChunk + 1) * cellCount / chunkCount;
+
+            for (std::size_t iColored=iChunkBegin; iColored<iChunkEnd; ++iColored) {
+                const std::size_t iCell = rColoring.cells[iColored];
+                const std::size_t localSize = rSlotMap.begins[iCell + 1] - rSlotMap.begins[iCell];
+                CIE_OUT_OF_RANGE_CHECK(localSize <= localCapacity)
+                std::fill(pLocalMatrix, pLocalMatrix + localSize, static_cast<TValue>(0));
+                rCellKernel(_cellIDs[iCell], pLocalMatrix);
+
+                Ptr<const TValue> pLocal = pLocalMatrix;
+                for (std::size_t iSlot=rSlotMap.begins[iCell]; iSlot<rSlotMap.begins[iCell + 1]; ++iSlot, ++pLocal) {
+                    const TIndex iNonzero = rSlotMap.slots[iSlot];
+                    if (iNonzero != SlotMap<TIndex>::skip) rNonzeros[iNonzero] += *pLocal;
+                }
+            } // for iColored in range(iChunkBegin, iChunkEnd)
         };
 
-        if (threadCount < 2) {
-            for (auto& rIndices : columnIndices) job(rIndices);
+        if (chunkCount < 2) {
+            for (std::size_t iChunk=0ul; iChunk<chunkCount; ++iChunk) job(iChunk);
         } else {
-            mp::ParallelFor<>(rThreadPool.value())(columnIndices, job);
+            mp::ParallelFor<>(rThreadPool.value())(chunkCount, job);
         }
+    } // for iColor in range(colorCount)
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+template <class TValue>
+void BasicAssembler<TDoFIndex>::assemble(VertexID cellID,
+                                         Ptr<const TValue> pLocalVector,
+                                         Ref<DynamicArray<TValue>> rVector) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const std::size_t freeDoFCount = this->freeDoFCount();
+    for (const DoFIndex iDoF : (*this)[cellID]) {
+        const TValue component = *pLocalVector++;
+        if (freeDoFCount <= iDoF) continue;
+        CIE_OUT_OF_RANGE_CHECK(iDoF < rVector.size())
+        rVector[iDoF] += component;
     }
 
-    // Compute row extents
-    rRowExtents.resize(rowCount + 1);
-    rRowExtents.front() = 0;
+    CIE_END_EXCEPTION_TRACING
+}
 
-    std::inclusive_scan(columnIndices.begin(),
-                        columnIndices.end(),
-                        rRowExtents.begin() + 1,
-                        [](TIndex left, const auto& rRight) -> TIndex {return left + rRight.size();},
-                        static_cast<TIndex>(0));
 
-    // Copy column indices to CSR container
-    rColumnIndices.resize(rRowExtents.back());
-    rNonzeros.resize(rRowExtents.back());
+template <concepts::UnsignedInteger TDoFIndex>
+template <class TValue>
+void BasicAssembler<TDoFIndex>::assembleLumped(VertexID cellID,
+                                               Ptr<const TValue> pLocalMatrix,
+                                               Ref<DynamicArray<TValue>> rDiagonal) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
 
-    {
-        const auto job = [&columnIndices, &rColumnIndices, &rRowExtents] (const TIndex iRow) {
-            std::copy(columnIndices[iRow].begin(),
-                      columnIndices[iRow].end(),
-                      rColumnIndices.begin() + rRowExtents[iRow]);
-        };
+    const auto dofs = (*this)[cellID];
+    const std::size_t freeDoFCount = this->freeDoFCount();
+    for (const DoFIndex iDoF : dofs) {
+        const Ptr<const TValue> pRow = pLocalMatrix;
+        pLocalMatrix += dofs.size();
+        if (freeDoFCount <= iDoF) continue;
+        CIE_OUT_OF_RANGE_CHECK(iDoF < rDiagonal.size())
 
-        if (threadCount < 2) {
-            for (TIndex iRow=0; iRow<rowCount; ++iRow) job(iRow);
-        } else {
-            mp::ParallelFor<>(rThreadPool.value())(rowCount, job);
+        TValue rowSum = static_cast<TValue>(0);
+        for (std::size_t iColumn=0ul; iColumn<dofs.size(); ++iColumn) rowSum += pRow[iColumn];
+        rDiagonal[iDoF] += rowSum;
+    } // for iDoF in dofs
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+template <class TIndex, class TValue>
+void BasicAssembler<TDoFIndex>::assembleBlock(VertexID cellID,
+                                              Ptr<const TValue> pLocalMatrix,
+                                              Ref<const DynamicArray<TIndex>> rRowExtents,
+                                              Ref<const DynamicArray<TIndex>> rColumnIndices,
+                                              Ref<DynamicArray<TValue>> rNonzeros) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const auto nodes = (*this)[cellID];
+    const std::size_t blockSize = _componentCount;
+    const std::size_t localSize = nodes.size() * blockSize;
+
+    this->template forEachNonzero<false>(nodes,
+                                         rRowExtents,
+                                         rColumnIndices,
+                                         [pLocalMatrix, blockSize, localSize, &nodes, &rNonzeros](std::size_t iLocalBlock, TIndex iBlock) {
+                                             // Copy the block row by row
+                                             const std::size_t iLocalRowNode = iLocalBlock / nodes.size();
+                                             const std::size_t iLocalColumnNode = iLocalBlock % nodes.size();
+                                             Ptr<const TValue> pSource = pLocalMatrix
+                                                                       + iLocalRowNode * blockSize * localSize
+                                                                       + iLocalColumnNode * blockSize;
+                                             Ptr<TValue> pTarget = rNonzeros.data() + iBlock * blockSize * blockSize;
+                                             CIE_OUT_OF_RANGE_CHECK(pTarget + blockSize * blockSize <= rNonzeros.data() + rNonzeros.size())
+                                             for (std::size_t iComponent=0ul; iComponent<blockSize; ++iComponent) {
+                                                 for (std::size_t jComponent=0ul; jComponent<blockSize; ++jComponent) {
+                                                     pTarget[jComponent] += pSource[jComponent];
+                                                 }
+                                                 pSource += localSize;
+                                                 pTarget += blockSize;
+                                             }
+                                         });
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+template <class TValue>
+void BasicAssembler<TDoFIndex>::assembleBlock(VertexID cellID,
+                                              Ptr<const TValue> pLocalVector,
+                                              Ref<DynamicArray<TValue>> rVector) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const std::size_t freeNodeCount = this->freeDoFCount();
+    for (const DoFIndex iNode : (*this)[cellID]) {
+        if (freeNodeCount <= iNode) {
+            pLocalVector += _componentCount;
+            continue;
         }
+        CIE_OUT_OF_RANGE_CHECK((iNode + 1) * _componentCount <= rVector.size())
+        const auto itBegin = rVector.begin() + iNode * _componentCount;
+        for (auto it=itBegin; it!=itBegin+_componentCount; ++it) *it += *pLocalVector++;
     }
 
     CIE_END_EXCEPTION_TRACING
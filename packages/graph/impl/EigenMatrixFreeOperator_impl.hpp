@@ -0,0 +1,91 @@
+#ifndef CIE_FEM_EIGEN_MATRIX_FREE_OPERATOR_IMPL_HPP
+#define CIE_FEM_EIGEN_MATRIX_FREE_OPERATOR_IMPL_HPP
+
+// --- FEM Includes ---
+#include "packages/graph/inc/EigenMatrixFreeOperator.hpp"
+
+// --- Utility Includes ---
+#include "packages/macros/inc/exceptions.hpp"
+
+
+namespace cie::fem {
+
+
+template <class TValue, concepts::UnsignedInteger TDoFIndex>
+EigenMatrixFreeOperator<TValue,TDoFIndex>::EigenMatrixFreeOperator(Ref<const MatrixFreeOperator<TValue,TDoFIndex>> rOperator)
+    : _pOperator(&rOperator),
+      _diagonal(rOperator.size()),
+      _buffer(rOperator.size())
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+    rOperator.diagonal(_diagonal.data());
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TValue, concepts::UnsignedInteger TDoFIndex>
+Eigen::Index EigenMatrixFreeOperator<TValue,TDoFIndex>::rows() const noexcept
+{
+    return static_cast<Eigen::Index>(_pOperator->size());
+}
+
+
+template <class TValue, concepts::UnsignedInteger TDoFIndex>
+Eigen::Index EigenMatrixFreeOperator<TValue,TDoFIndex>::cols() const noexcept
+{
+    return static_cast<Eigen::Index>(_pOperator->size());
+}
+
+
+template <class TValue, concepts::UnsignedInteger TDoFIndex>
+Ref<const typename EigenMatrixFreeOperator<TValue,TDoFIndex>::Vector>
+EigenMatrixFreeOperator<TValue,TDoFIndex>::diagonal() const noexcept
+{
+    return _diagonal;
+}
+
+
+template <class TValue, concepts::UnsignedInteger TDoFIndex>
+Eigen::Map<const typename EigenMatrixFreeOperator<TValue,TDoFIndex>::Vector>
+EigenMatrixFreeOperator<TValue,TDoFIndex>::product(Ptr<const TValue> pInput) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+    _pOperator->product(pInput, _buffer.data());
+    return Eigen::Map<const Vector>(_buffer.data(), _buffer.size());
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+} // namespace cie::fem
+
+
+namespace Eigen::internal {
+
+
+/// @brief Product of the matrix-free operator with a dense vector.
+template <class TValue, cie::concepts::UnsignedInteger TDoFIndex, class TRhs>
+struct generic_product_impl<cie::fem::EigenMatrixFreeOperator<TValue,TDoFIndex>,TRhs,SparseShape,DenseShape,GemvProduct>
+    : generic_product_impl_base<cie::fem::EigenMatrixFreeOperator<TValue,TDoFIndex>,
+                                TRhs,
+                                generic_product_impl<cie::fem::EigenMatrixFreeOperator<TValue,TDoFIndex>,TRhs>>
+{
+    using Lhs = cie::fem::EigenMatrixFreeOperator<TValue,TDoFIndex>;
+
+    using Scalar = typename Product<Lhs,TRhs>::Scalar;
+
+    template <class TDestination>
+    static void scaleAndAddTo(TDestination& rDestination,
+                              const Lhs& rLhs,
+                              const TRhs& rRhs,
+                              const Scalar& rScale)
+    {
+        // Contiguous vectors are bound without a copy
+        const Eigen::Ref<const typename Lhs::Vector> input(rRhs);
+        rDestination.noalias() += rScale * rLhs.product(input.data());
+    }
+}; // struct generic_product_impl
+
+
+} // namespace Eigen::internal
+
+#endif
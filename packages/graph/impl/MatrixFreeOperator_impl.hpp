@@ -0,0 +1,201 @@
+#ifndef CIE_FEM_MATRIX_FREE_OPERATOR_IMPL_HPP
+#define CIE_FEM_MATRIX_FREE_OPERATOR_IMPL_HPP
+
+// --- FEM Includes ---
+#include "packages/graph/inc/MatrixFreeOperator.hpp"
+
+// --- Utility Includes ---
+#include "packages/macros/inc/exceptions.hpp"
+#include "packages/macros/inc/checks.hpp"
+#include "packages/concurrency/inc/ParallelFor.hpp"
+
+// --- STL Includes ---
+#include <algorithm> // max, min, fill
+
+
+namespace cie::fem {
+
+
+template <class TValue, concepts::UnsignedInteger TDoFIndex>
+MatrixFreeOperator<TValue,TDoFIndex>::MatrixFreeOperator(Ref<const Assembler> rAssembler,
+                                                         CellKernel&& rCellKernel,
+                                                         std::size_t bufferSize,
+                                                         OptionalRef<mp::ThreadPoolBase> rThreadPool)
+    : _pAssembler(&rAssembler),
+      _cellKernel(std::move(rCellKernel)),
+      _bufferSize(bufferSize),
+      _threadPool(rThreadPool),
+      _coloring(),
+      _maxLocalSize(0ul),
+      _buffers()
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    for (const auto dofs : rAssembler.values()) {
+        _maxLocalSize = std::max(_maxLocalSize, dofs.size());
+    }
+
+    if (_threadPool.has_value() && 1 < _threadPool.value().size()) {
+        rAssembler.makeColoring(_coloring);
+    }
+
+    // Each chunk of cells gets its own local vectors and scratch space
+    const std::size_t threadCount = _threadPool.has_value() ? _threadPool.value().size() : 1ul;
+    _buffers.resize(threadCount * this->getChunkBufferSize());
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TValue, concepts::UnsignedInteger TDoFIndex>
+std::size_t MatrixFreeOperator<TValue,TDoFIndex>::getChunkBufferSize() const noexcept
+{
+    return 2 * _maxLocalSize + _bufferSize;
+}
+
+
+template <class TValue, concepts::UnsignedInteger TDoFIndex>
+template <class TFunction>
+void MatrixFreeOperator<TValue,TDoFIndex>::forEachCell(TFunction&& rFunction) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    Ref<const Assembler> rAssembler = *_pAssembler;
+    const std::size_t threadCount = _threadPool.has_value() ? _threadPool.value().size() : 1ul;
+    const std::size_t bufferSize = this->getChunkBufferSize();
+
+    const auto applyCell = [this, &rFunction, bufferSize](std::size_t iCell, std::size_t iChunk) -> void {
+        rFunction(iCell, _buffers.data() + iChunk * bufferSize);
+    };
+
+    if (threadCount < 2) {
+        for (std::size_t iCell=0ul; iCell<rAssembler.cellCount(); ++iCell) applyCell(iCell, 0ul);
+    } else {
+        // Cells of the same color share no DoFs, so they scatter to disjoint components
+        for (std::size_t iColor=0ul; iColor+1<_coloring.colorExtents.size(); ++iColor) {
+            const std::size_t iCellBegin = _coloring.colorExtents[iColor];
+            const std::size_t cellCount = _coloring.colorExtents[iColor + 1] - iCellBegin;
+            const std::size_t chunkCount = std::min(threadCount, cellCount);
+            mp::ParallelFor<>(_threadPool.value())(chunkCount, [&](std::size_t iChunk) -> void {
+                const std::size_t iChunkEnd = iCellBegin + (iChunk + 1) * cellCount / chunkCount;
+                for (std::size_t iColored=iCellBegin + iChunk * cellCount / chunkCount; iColored<iChunkEnd; ++iColored) {
+                    applyCell(_coloring.cells[iColored], iChunk);
+                }
+            });
+        } // for iColor in range(colorCount)
+    }
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TValue, concepts::UnsignedInteger TDoFIndex>
+template <class TGather, class TScatter>
+void MatrixFreeOperator<TValue,TDoFIndex>::apply(TGather&& rGather, TScatter&& rScatter) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    Ref<const Assembler> rAssembler = *_pAssembler;
+    this->forEachCell([this, &rAssembler, &rGather, &rScatter](std::size_t iCell, Ptr<TValue> pLocalInput) -> void {
+        const auto dofs = rAssembler.getDoFs(iCell);
+        const Ptr<TValue> pLocalOutput = pLocalInput + _maxLocalSize;
+
+        for (std::size_t iLocal=0ul; iLocal<dofs.size(); ++iLocal) rGather(iLocal, dofs[iLocal], pLocalInput[iLocal]);
+        _cellKernel(rAssembler.getCellID(iCell),
+                    pLocalInput,
+                    pLocalOutput,
+                    std::span<TValue>(pLocalOutput + _maxLocalSize, _bufferSize));
+        for (std::size_t iLocal=0ul; iLocal<dofs.size(); ++iLocal) rScatter(iLocal, dofs[iLocal], pLocalOutput[iLocal]);
+    });
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TValue, concepts::UnsignedInteger TDoFIndex>
+void MatrixFreeOperator<TValue,TDoFIndex>::product(Ptr<const TValue> pInput, Ptr<TValue> pOutput) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    // Constrained DoFs are numbered after all free ones, and are skipped
+    const std::size_t freeDoFCount = this->size();
+    std::fill(pOutput, pOutput + freeDoFCount, static_cast<TValue>(0));
+    this->apply(
+        [pInput, freeDoFCount](std::size_t, TDoFIndex iDoF, Ref<TValue> rLocalInput) -> void {
+            rLocalInput = iDoF < freeDoFCount ? pInput[iDoF] : static_cast<TValue>(0);
+        },
+        [pOutput, freeDoFCount](std::size_t, TDoFIndex iDoF, TValue localOutput) -> void {
+            if (iDoF < freeDoFCount) pOutput[iDoF] += localOutput;
+        }
+    );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TValue, concepts::UnsignedInteger TDoFIndex>
+void MatrixFreeOperator<TValue,TDoFIndex>::liftConstraints(Ref<const DynamicArray<TValue>> rConstrainedValues,
+                                                           Ptr<TValue> pRhs) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const std::size_t freeDoFCount = this->size();
+    CIE_OUT_OF_RANGE_CHECK(freeDoFCount + rConstrainedValues.size() == _pAssembler->dofCount())
+
+    // Apply the operator to the prescribed values and subtract the free rows of the result
+    this->apply(
+        [&rConstrainedValues, freeDoFCount](std::size_t, TDoFIndex iDoF, Ref<TValue> rLocalInput) -> void {
+            rLocalInput = iDoF < freeDoFCount ? static_cast<TValue>(0) : rConstrainedValues[iDoF - freeDoFCount];
+        },
+        [pRhs, freeDoFCount](std::size_t, TDoFIndex iDoF, TValue localOutput) -> void {
+            if (iDoF < freeDoFCount) pRhs[iDoF] -= localOutput;
+        }
+    );
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TValue, concepts::UnsignedInteger TDoFIndex>
+void MatrixFreeOperator<TValue,TDoFIndex>::diagonal(Ptr<TValue> pDiagonal) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    Ref<const Assembler> rAssembler = *_pAssembler;
+    const std::size_t freeDoFCount = this->size();
+    std::fill(pDiagonal, pDiagonal + freeDoFCount, static_cast<TValue>(0));
+
+    // Apply each cell kernel to the local unit vectors of the cell's free DoFs
+    this->forEachCell([this, &rAssembler, pDiagonal, freeDoFCount](std::size_t iCell, Ptr<TValue> pLocalInput) -> void {
+        const auto dofs = rAssembler.getDoFs(iCell);
+        const Ptr<TValue> pLocalOutput = pLocalInput + _maxLocalSize;
+        const VertexID cellID = rAssembler.getCellID(iCell);
+
+        std::fill(pLocalInput, pLocalInput + dofs.size(), static_cast<TValue>(0));
+        for (std::size_t iLocal=0ul; iLocal<dofs.size(); ++iLocal) {
+            if (freeDoFCount <= dofs[iLocal]) continue;
+            pLocalInput[iLocal] = static_cast<TValue>(1);
+            _cellKernel(cellID,
+                        pLocalInput,
+                        pLocalOutput,
+                        std::span<TValue>(pLocalOutput + _maxLocalSize, _bufferSize));
+            pDiagonal[dofs[iLocal]] += pLocalOutput[iLocal];
+            pLocalInput[iLocal] = static_cast<TValue>(0);
+        } // for iLocal in range(dofs.size())
+    });
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TValue, concepts::UnsignedInteger TDoFIndex>
+std::size_t MatrixFreeOperator<TValue,TDoFIndex>::size() const noexcept
+{
+    return _pAssembler->freeDoFCount();
+}
+
+
+} // namespace cie::fem
+
+
+#endif
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <iterator>
 #include <numeric> // iota
+#include <cmath> // abs
 
 
 namespace std {
@@ -103,7 +104,7 @@ void scanConnectivities(Ref<const TAnsatzSpace> rAnsatzSpace,
                                    valueBuffer.data());
 
             for (Size iAnsatz=0; iAnsatz<ansatzSize; ++iAnsatz) {
-                if (tolerance < valueBuffer[iAnsatz]) {
+                if (tolerance < std::abs(valueBuffer[iAnsatz])) {
                     activeBoundaries.emplace(boundaryID, iAnsatz);
                 }
             }
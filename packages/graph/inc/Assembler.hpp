@@ -1,54 +1,139 @@
 #ifndef CIE_FEM_ASSEMBLER_HPP
 #define CIE_FEM_ASSEMBLER_HPP
 
+// --- External Includes ---
+#include "tsl/robin_map.h"
+
 // --- FEM Includes ---
 #include "packages/graph/inc/Graph.hpp"
+#include "packages/graph/inc/ordering.hpp"
 
 // --- Utility Includes ---
 #include "packages/compile_time/packages/concepts/inc/functional.hpp"
-#include "packages/maths/inc/Comparison.hpp"
+#include "packages/compile_time/packages/concepts/inc/basic_concepts.hpp"
 #include "packages/stl_extension/inc/DynamicArray.hpp"
 #include "packages/stl_extension/inc/StaticArray.hpp"
 #include "packages/concurrency/inc/ThreadPoolBase.hpp"
 
 // --- STL Includes ---
 #include <packages/macros/inc/checks.hpp>
-#include <unordered_map>
-#include <optional> // optional
-#include <ranges> // transform_view
-#include <set> // set
+#include <ranges> // transform_view, iota
+#include <span> // span
+#include <limits> // numeric_limits
 
 
 namespace cie::fem {
 
 
-class Assembler
+template <class TValue>
+class DirichletConstraints;
+
+
+/// @brief Assigns global DoF indices to the cells of graphs and assembles their contributions.
+/// @details The DoF indices of all cells are stored in a single contiguous array, with each cell
+///          owning a range of it. Cells are addressed by their @ref VertexID, or by a dense index
+///          in [0, @ref cellCount) that reflects the order in which they were registered.
+///          For vector-valued fields, the assembler can operate in block mode, in which each DoF
+///          it manages is a node carrying a fixed number of components (see @ref componentCount).
+///          Block matrices are then assembled in BSR format (see @ref makeBSRMatrix).
+///          Constrained DoFs can be moved behind all free ones (see @ref condense), after which
+///          matrices and vectors only cover free DoFs.
+/// @tparam TDoFIndex Unsigned integer type global DoF indices are stored as. Narrower types
+///                   reduce the memory footprint of the DoF map at the cost of a lower maximum
+///                   number of DoFs.
+template <concepts::UnsignedInteger TDoFIndex = std::size_t>
+class BasicAssembler
 {
+public:
+    using DoFIndex = TDoFIndex;
+
 private:
-    using DefaultMesh = Graph<void,void>;
+    /// @brief Placeholder for DoFs that have not been assigned a global index yet.
+    static constexpr DoFIndex _invalidDoF = std::numeric_limits<DoFIndex>::max();
 
-    using DoFMap = std::unordered_map<
-        VertexID,                                   // <== ID of the cell
-        DynamicArray<std::optional<std::size_t>>    // <== DoF indices of its basis functions
-    >;
+    /// @brief Number of DoFs a cell may have for @ref forEachNonzero to sort them on the stack.
+    static constexpr std::size_t _stackDoFCount = 0x100;
 
-    static auto makeIndexView(Ref<const DoFMap::mapped_type> rIndices)
-    {
-        return std::ranges::transform_view(
-            rIndices,
-            [](DoFMap::mapped_type::value_type maybeIndex){return maybeIndex.value();}
-        );
-    }
+    /// @brief Call a functor with the index of each local matrix entry and the nonzero it belongs to.
+    /// @tparam UpperTriangle Skip local entries that belong to the lower triangle of the global matrix.
+    /// @details Entries in the rows or columns of constrained DoFs are skipped (see @ref condense).
+    template <bool UpperTriangle, class TIndex, class TFunctor>
+    void forEachNonzero(std::span<const DoFIndex> dofs,
+                        Ref<const DynamicArray<TIndex>> rRowExtents,
+                        Ref<const DynamicArray<TIndex>> rColumnIndices,
+                        TFunctor&& rFunctor) const;
+
+    std::span<DoFIndex> getMutableDoFs(std::size_t iCell) noexcept;
+
+    /// @brief Compute the CSR sparsity pattern of the DoF couplings within cells.
+    /// @param upperTriangle Only include column indices that are not less than their row index.
+    template <class TIndex>
+    void makeSparsityPattern(Ref<DynamicArray<TIndex>> rRowExtents,
+                             Ref<DynamicArray<TIndex>> rColumnIndices,
+                             bool upperTriangle,
+                             OptionalRef<mp::ThreadPoolBase> rThreadPool) const;
+
+    template <class TEdge, class TDoFPairFunctor>
+    void numberDoFs(std::span<const Ptr<const TEdge>> edges,
+                    TDoFPairFunctor&& rDoFMatcher,
+                    Ref<mp::ThreadPoolBase> rThreadPool);
 
 public:
+    /// @brief Offsets of the entries of each cell's local matrix in the nonzeros of a CSR matrix.
+    /// @details The offsets of the row-major local matrix of the cell with dense index @a i
+    ///          are stored contiguously in @ref slots, in the range
+    ///          [@ref begins "begins[i]", @ref begins "begins[i+1]").
+    template <class TIndex>
+    struct SlotMap
+    {
+        /// @brief Slot of local entries that are not assembled (see @ref makeSymmetricCSRMatrix).
+        static constexpr TIndex skip = std::numeric_limits<TIndex>::max();
+
+        DynamicArray<TIndex> slots;
+
+        DynamicArray<std::size_t> begins;
+    }; // struct SlotMap
+
+    /// @brief Partition of cells into colors, none of which contain two cells that share a DoF.
+    /// @details The dense indices of cells of color @a i are stored in @ref cells, in the range
+    ///          [@ref colorExtents "colorExtents[i]", @ref colorExtents "colorExtents[i+1]").
+    struct Coloring
+    {
+        DynamicArray<std::size_t> cells;
+
+        DynamicArray<std::size_t> colorExtents;
+
+        /// @brief Largest number of DoFs of any colored cell, which bounds the size of local matrices.
+        std::size_t maxLocalSize = 0ul;
+    }; // struct Coloring
+
     using DoFPairVector = DynamicArray<std::pair<std::size_t,std::size_t>>;
 
     using DoFPairIterator = std::back_insert_iterator<DoFPairVector>;
 
-    Assembler() noexcept;
+    BasicAssembler() noexcept;
+
+    explicit BasicAssembler(std::size_t dofBegin) noexcept;
 
-    explicit Assembler(std::size_t dofBegin) noexcept;
+    /// @brief Construct an assembler in block mode.
+    /// @param dofBegin First global node index to assign.
+    /// @param componentCount Number of components each node carries. DoF counters passed
+    ///                       to @ref addGraph must then return the number of nodes of a cell.
+    BasicAssembler(std::size_t dofBegin, std::size_t componentCount);
 
+    /// @brief Register the vertices of a graph as cells and assign global indices to their DoFs.
+    /// @param rGraph Graph whose vertices are cells and whose edges are cell boundaries.
+    /// @param rDoFCounter Functor returning the number of DoFs of a cell.
+    /// @param rDoFMatcher Functor writing the pairs of local DoFs that coincide on a boundary.
+    /// @param rThreadPool Optional thread pool to number DoFs in parallel. The DoF matcher
+    ///                    is invoked concurrently in that case.
+    /// @details Without a thread pool, the graph is traversed breadth-first and DoFs are
+    ///          numbered in the order they are discovered. With a thread pool, all edges
+    ///          are matched in parallel to merge coinciding DoFs into equivalence classes
+    ///          (using a lock-free union-find), which are then numbered in parallel in the
+    ///          order of the cells.
+    /// @throws If a cell's local DoFs would be merged into the same global DoF, or if
+    ///         two DoFs that were previously assigned different global indices coincide.
     template <class TVertexData,
               class TEdgeData,
               class TGraphData,
@@ -56,10 +141,30 @@ public:
               concepts::FunctionWithSignature<void,Ref<const typename Graph<TVertexData,TEdgeData,TGraphData>::Edge>,DoFPairIterator> TDoFPairFunctor>
     void addGraph(Ref<const Graph<TVertexData,TEdgeData,TGraphData>> rGraph,
                   TDoFCounter&& rDoFCounter,
-                  TDoFPairFunctor&& rDoFMatcher);
+                  TDoFPairFunctor&& rDoFMatcher,
+                  OptionalRef<mp::ThreadPoolBase> rThreadPool = {});
 
     std::size_t dofCount() const noexcept;
 
+    /// @brief Number of DoFs that are not constrained, which is the size of the assembled system.
+    /// @details Equal to @ref dofCount unless the assembler was @ref condense "condensed".
+    std::size_t freeDoFCount() const noexcept;
+
+    /// @brief Number of components of each DoF, which is the size of the blocks of BSR matrices.
+    std::size_t componentCount() const noexcept;
+
+    /// @brief Number of cells registered in the assembler.
+    std::size_t cellCount() const noexcept;
+
+    /// @brief Get the dense index of the cell with the provided @ref VertexID.
+    std::size_t getCellIndex(VertexID cellID) const;
+
+    /// @brief Get the @ref VertexID of the cell with the provided dense index.
+    VertexID getCellID(std::size_t iCell) const;
+
+    /// @brief Get the global DoF indices of the cell with the provided dense index.
+    std::span<const DoFIndex> getDoFs(std::size_t iCell) const;
+
     template <class TIndex, class TValue>
     void makeCSRMatrix(Ref<TIndex> rRowCount,
                        Ref<TIndex> rColumnCount,
@@ -68,45 +173,277 @@ public:
                        Ref<DynamicArray<TValue>> rNonzeros,
                        OptionalRef<mp::ThreadPoolBase> rThreadPool = {}) const;
 
-    auto keys() const
+    /// @brief Construct a CSR matrix and the map of each cell's local entries to its nonzeros.
+    /// @details The resulting @ref SlotMap turns repeated assembly into the same sparsity
+    ///          pattern into a pure indexed add (see @ref assemble).
+    template <class TIndex, class TValue>
+    void makeCSRMatrix(Ref<TIndex> rRowCount,
+                       Ref<TIndex> rColumnCount,
+                       Ref<DynamicArray<TIndex>> rRowExtents,
+                       Ref<DynamicArray<TIndex>> rColumnIndices,
+                       Ref<DynamicArray<TValue>> rNonzeros,
+                       Ref<SlotMap<TIndex>> rSlotMap,
+                       OptionalRef<mp::ThreadPoolBase> rThreadPool = {}) const;
+
+    /// @brief Construct the upper triangle of a symmetric CSR matrix, including its diagonal.
+    /// @details Only column indices that are not less than their row index are stored, roughly
+    ///          halving the memory footprint of the matrix compared to @ref makeCSRMatrix.
+    ///          Contributions must be added with @ref assembleSymmetric, and products computed
+    ///          with @ref symmetricSpmv.
+    template <class TIndex, class TValue>
+    void makeSymmetricCSRMatrix(Ref<TIndex> rRowCount,
+                                Ref<TIndex> rColumnCount,
+                                Ref<DynamicArray<TIndex>> rRowExtents,
+                                Ref<DynamicArray<TIndex>> rColumnIndices,
+                                Ref<DynamicArray<TValue>> rNonzeros,
+                                OptionalRef<mp::ThreadPoolBase> rThreadPool = {}) const;
+
+    /// @brief Construct the upper triangle of a symmetric CSR matrix and the map of each cell's local entries to its nonzeros.
+    /// @details Local entries that fall into the lower triangle are mapped to @ref SlotMap::skip,
+    ///          so the slot based overloads of @ref assemble only add the upper triangle.
+    template <class TIndex, class TValue>
+    void makeSymmetricCSRMatrix(Ref<TIndex> rRowCount,
+                                Ref<TIndex> rColumnCount,
+                                Ref<DynamicArray<TIndex>> rRowExtents,
+                                Ref<DynamicArray<TIndex>> rColumnIndices,
+                                Ref<DynamicArray<TValue>> rNonzeros,
+                                Ref<SlotMap<TIndex>> rSlotMap,
+                                OptionalRef<mp::ThreadPoolBase> rThreadPool = {}) const;
+
+    /// @brief Construct a block sparse row (BSR) matrix with dense blocks of @ref componentCount rows and columns.
+    /// @param rRowCount Number of block rows.
+    /// @param rColumnCount Number of block columns.
+    /// @param rRowExtents Extents of each block row in @a rColumnIndices.
+    /// @param rColumnIndices Block column index of each block.
+    /// @param rNonzeros Entries of all blocks, each stored contiguously in row-major order.
+    /// @details The block pattern is identical to the scalar pattern @ref makeCSRMatrix constructs
+    ///          from the DoF map, so index storage does not grow with the number of components.
+    template <class TIndex, class TValue>
+    void makeBSRMatrix(Ref<TIndex> rRowCount,
+                       Ref<TIndex> rColumnCount,
+                       Ref<DynamicArray<TIndex>> rRowExtents,
+                       Ref<DynamicArray<TIndex>> rColumnIndices,
+                       Ref<DynamicArray<TValue>> rNonzeros,
+                       OptionalRef<mp::ThreadPoolBase> rThreadPool = {}) const;
+
+    /// @brief Greedily color cells such that no two cells of the same color share a DoF.
+    /// @details Cells are colored based on their DoFs rather than the adjacency of the graph
+    ///          they were added from, because cells that only share a corner are not adjacent
+    ///          in the graph but still share DoFs.
+    void makeColoring(Ref<Coloring> rColoring) const;
+
+    /// @brief Permute the global DoF indices to improve the locality of the assembled matrix.
+    /// @param ordering Algorithm to compute the new order of DoFs with (see @ref DoFOrdering).
+    /// @returns The @ref SparsityStatistics of the matrix before and after renumbering.
+    /// @details The set of global DoF indices in use is preserved, only their assignment to
+    ///          DoFs changes. Matrices and slot maps constructed before renumbering are invalidated.
+    std::pair<SparsityStatistics,SparsityStatistics> renumber(DoFOrdering ordering);
+
+    /// @brief Renumber DoFs such that constrained DoFs come after all free ones.
+    /// @param rConstraints Dirichlet conditions on the current global DoF indices.
+    /// @param rConstrainedValues Output array of prescribed values, where the DoF with global
+    ///                           index @a i holds value @a rConstrainedValues[i - freeDoFCount()].
+    /// @returns The number of free DoFs.
+    /// @details Free DoFs keep their relative order, so the locality gained by a previous call
+    ///          to @ref renumber is preserved. Afterwards, matrices only contain the rows and columns
+    ///          of free DoFs, and constrained DoFs are skipped during assembly. Their contributions
+    ///          can be moved to the right hand side while assembling (see @ref assemble), which
+    ///          removes the need for imposing the constraints on the assembled system.
+    ///          Cells cannot be added, nor can the DoFs be renumbered, after condensing.
+    ///          In block mode, constraints refer to entire nodes.
+    template <class TValue>
+    std::size_t condense(Ref<const DirichletConstraints<TValue>> rConstraints,
+                         Ref<DynamicArray<TValue>> rConstrainedValues);
+
+    /// @brief Recover the full vector of a condensed system.
+    /// @param pReducedVector Vector of free DoFs with @ref freeDoFCount components.
+    /// @param rConstrainedValues Prescribed values constructed by @ref condense.
+    /// @param pVector Output vector with @ref dofCount components.
+    template <class TValue>
+    void expand(Ptr<const TValue> pReducedVector,
+                Ref<const DynamicArray<TValue>> rConstrainedValues,
+                Ptr<TValue> pVector) const;
+
+    /// @brief Add a cell's dense local matrix to a CSR matrix constructed by @ref makeCSRMatrix.
+    /// @param cellID ID of the cell the local matrix belongs to.
+    /// @param pLocalMatrix Row-major, square local matrix with as many rows as the cell has DoFs.
+    /// @details Local entries are visited in order of their global column indices, which lets
+    ///          each row of the CSR matrix be traversed once instead of searched for every entry.
+    template <class TIndex, class TValue>
+    void assemble(VertexID cellID,
+                  Ptr<const TValue> pLocalMatrix,
+                  Ref<const DynamicArray<TIndex>> rRowExtents,
+                  Ref<const DynamicArray<TIndex>> rColumnIndices,
+                  Ref<DynamicArray<TValue>> rNonzeros) const;
+
+    /// @brief Add a cell's dense local matrix to a condensed CSR matrix and move the contributions of constrained DoFs to the right hand side.
+    /// @param cellID ID of the cell the local matrix belongs to.
+    /// @param pLocalMatrix Row-major, square local matrix with as many rows as the cell has DoFs.
+    /// @param rConstrainedValues Prescribed values constructed by @ref condense.
+    /// @param rRhs Right hand side with @ref freeDoFCount components.
+    /// @details Entries coupling a free row with a constrained column are multiplied by the
+    ///          prescribed value and subtracted from the right hand side instead of being assembled.
+    template <class TIndex, class TValue>
+    void assemble(VertexID cellID,
+                  Ptr<const TValue> pLocalMatrix,
+                  Ref<const DynamicArray<TIndex>> rRowExtents,
+                  Ref<const DynamicArray<TIndex>> rColumnIndices,
+                  Ref<DynamicArray<TValue>> rNonzeros,
+                  Ref<const DynamicArray<TValue>> rConstrainedValues,
+                  Ref<DynamicArray<TValue>> rRhs) const;
+
+    /// @brief Add the upper triangle of a cell's symmetric local matrix to a CSR matrix constructed by @ref makeSymmetricCSRMatrix.
+    /// @param cellID ID of the cell the local matrix belongs to.
+    /// @param pLocalMatrix Row-major, square local matrix with as many rows as the cell has DoFs.
+    /// @details Local entries are filtered by their global indices, so the local matrix may be
+    ///          in any DoF order, but must be symmetric.
+    template <class TIndex, class TValue>
+    void assembleSymmetric(VertexID cellID,
+                           Ptr<const TValue> pLocalMatrix,
+                           Ref<const DynamicArray<TIndex>> rRowExtents,
+                           Ref<const DynamicArray<TIndex>> rColumnIndices,
+                           Ref<DynamicArray<TValue>> rNonzeros) const;
+
+    /// @brief Add a cell's dense local matrix to the nonzeros of a CSR matrix, using a precomputed @ref SlotMap.
+    /// @param cellID ID of the cell the local matrix belongs to.
+    /// @param pLocalMatrix Row-major, square local matrix with as many rows as the cell has DoFs.
+    /// @param rSlotMap Slot map constructed along with the CSR matrix by @ref makeCSRMatrix.
+    template <class TIndex, class TValue>
+    void assemble(VertexID cellID,
+                  Ptr<const TValue> pLocalMatrix,
+                  Ref<const SlotMap<TIndex>> rSlotMap,
+                  Ref<DynamicArray<TValue>> rNonzeros) const;
+
+    /// @brief Assemble the local matrices of all cells into a CSR matrix in parallel.
+    /// @param rColoring Coloring of the cells constructed by @ref makeColoring.
+    /// @param rCellKernel Functor computing a cell's row-major local matrix, with the signature
+    ///                    @code void(VertexID cellID, Ptr<TValue> pLocalMatrix) @endcode
+    ///                    It is invoked concurrently from multiple threads.
+    /// @param rSlotMap Slot map constructed along with the CSR matrix by @ref makeCSRMatrix.
+    /// @param rNonzeros Nonzeros of the CSR matrix to add the local matrices to.
+    /// @param rThreadPool Thread pool to distribute the cells of each color on.
+    /// @details Colors are processed one after the other, and the cells within a color are split
+    ///          into one chunk per thread. Since cells of the same color share no DoFs, they
+    ///          write to disjoint nonzeros and need no synchronization.
+    template <class TIndex, class TValue, class TCellKernel>
+    void assemble(Ref<const Coloring> rColoring,
+                  TCellKernel&& rCellKernel,
+                  Ref<const SlotMap<TIndex>> rSlotMap,
+                  Ref<DynamicArray<TValue>> rNonzeros,
+                  OptionalRef<mp::ThreadPoolBase> rThreadPool = {}) const;
+
+    /// @brief Assemble the local matrices of all cells into a CSR matrix in parallel.
+    /// @details Identical to the overload without a buffer, but computes the local matrices in
+    ///          @a rBuffer. The buffer only grows, so passing the same one to repeated assemblies
+    ///          avoids allocating memory after the first call.
+    /// @param rBuffer Scratch space for one local matrix per thread, resized as necessary.
+    template <class TIndex, class TValue, class TCellKernel>
+    void assemble(Ref<const Coloring> rColoring,
+                  TCellKernel&& rCellKernel,
+                  Ref<const SlotMap<TIndex>> rSlotMap,
+                  Ref<DynamicArray<TValue>> rNonzeros,
+                  Ref<DynamicArray<TValue>> rBuffer,
+                  OptionalRef<mp::ThreadPoolBase> rThreadPool = {}) const;
+
+    /// @brief Add a cell's dense local vector to a global vector.
+    /// @param cellID ID of the cell the local vector belongs to.
+    /// @param pLocalVector Local vector with as many components as the cell has DoFs.
+    template <class TValue>
+    void assemble(VertexID cellID,
+                  Ptr<const TValue> pLocalVector,
+                  Ref<DynamicArray<TValue>> rVector) const;
+
+    /// @brief Add the row sums of a cell's dense local matrix to a global vector.
+    /// @param cellID ID of the cell the local matrix belongs to.
+    /// @param pLocalMatrix Row-major, square local matrix with as many rows as the cell has DoFs.
+    /// @param rDiagonal Diagonal of the lumped global matrix, with @ref freeDoFCount components.
+    /// @details Row-sum lumping replaces a matrix by a diagonal one, which is assembled into a vector
+    ///          instead of a CSR pattern. For mass matrices of a Lagrange basis collocated with the
+    ///          integration points of a @ref GaussLobattoQuadrature, the local matrix is already
+    ///          diagonal, so lumping is exact. Rows of constrained DoFs are skipped.
+    template <class TValue>
+    void assembleLumped(VertexID cellID,
+                        Ptr<const TValue> pLocalMatrix,
+                        Ref<DynamicArray<TValue>> rDiagonal) const;
+
+    /// @brief Add a cell's dense local matrix to a BSR matrix constructed by @ref makeBSRMatrix.
+    /// @param cellID ID of the cell the local matrix belongs to.
+    /// @param pLocalMatrix Row-major, square local matrix with as many rows as the cell has nodes
+    ///                     times @ref componentCount. Rows and columns are ordered node by node,
+    ///                     with the components of each node stored contiguously.
+    template <class TIndex, class TValue>
+    void assembleBlock(VertexID cellID,
+                       Ptr<const TValue> pLocalMatrix,
+                       Ref<const DynamicArray<TIndex>> rRowExtents,
+                       Ref<const DynamicArray<TIndex>> rColumnIndices,
+                       Ref<DynamicArray<TValue>> rNonzeros) const;
+
+    /// @brief Add a cell's dense local vector to a global vector with @ref componentCount components per node.
+    /// @param cellID ID of the cell the local vector belongs to.
+    /// @param pLocalVector Local vector ordered node by node, with the components of each node stored contiguously.
+    template <class TValue>
+    void assembleBlock(VertexID cellID,
+                       Ptr<const TValue> pLocalVector,
+                       Ref<DynamicArray<TValue>> rVector) const;
+
+    auto keys() const noexcept
     {
-        return std::ranges::views::keys(_dofMap);
+        return std::span<const VertexID>(_cellIDs);
     }
 
     auto values() const
     {
         return std::ranges::transform_view(
-            _dofMap,
-            [](const auto& rPair) {return Assembler::makeIndexView(rPair.second);}
+            std::ranges::views::iota(0ul, this->cellCount()),
+            [this](std::size_t iCell) {return this->getDoFs(iCell);}
         );
     }
 
     auto items() const
     {
         return std::ranges::transform_view(
-            _dofMap,
-            [](const auto& rPair) {
-                return std::make_pair(rPair.first,
-                                      Assembler::makeIndexView(rPair.second));
+            std::ranges::views::iota(0ul, this->cellCount()),
+            [this](std::size_t iCell) {
+                return std::make_pair(_cellIDs[iCell], this->getDoFs(iCell));
             }
         );
     }
 
-    auto operator[](VertexID vertexID) const
+    std::span<const DoFIndex> operator[](VertexID vertexID) const
     {
-        const auto it = _dofMap.find(vertexID);
-        CIE_OUT_OF_RANGE_CHECK(it != _dofMap.end())
-        return this->makeIndexView(it->second);
+        return this->getDoFs(this->getCellIndex(vertexID));
     }
 
 private:
+    /// @brief Map each cell's local entries to the nonzeros of a CSR matrix.
+    template <bool UpperTriangle, class TIndex>
+    void makeSlotMap(Ref<const DynamicArray<TIndex>> rRowExtents,
+                     Ref<const DynamicArray<TIndex>> rColumnIndices,
+                     Ref<SlotMap<TIndex>> rSlotMap,
+                     OptionalRef<mp::ThreadPoolBase> rThreadPool) const;
+
     std::size_t _dofCounter;
 
-    DoFMap _dofMap;
+    std::size_t _componentCount;
+
+    /// @brief Number of DoFs moved behind the free ones by @ref condense.
+    std::size_t _constrainedDoFCount;
+
+    /// @brief Map of @ref VertexID "vertex IDs" to dense cell indices.
+    tsl::robin_map<VertexID,std::size_t> _cellIndices;
+
+    /// @brief Map of dense cell indices to @ref VertexID "vertex IDs".
+    DynamicArray<VertexID> _cellIDs;
+
+    /// @brief Begin of each cell's range in @ref _dofIndices, and the end of the last one.
+    DynamicArray<std::size_t> _dofExtents;
+
+    /// @brief Global DoF indices of all cells, contiguous per cell.
+    DynamicArray<DoFIndex> _dofIndices;
+}; // class BasicAssembler
+
 
-    using IndexPair = StaticArray<std::size_t,2>;
-    std::set<IndexPair,utils::Ordering<IndexPair>> _sparsityPattern;
-}; // class Assembler
+using Assembler = BasicAssembler<>;
 
 
 } // namespace cie::fem
@@ -0,0 +1,154 @@
+#ifndef CIE_FEM_EIGEN_MATRIX_FREE_OPERATOR_HPP
+#define CIE_FEM_EIGEN_MATRIX_FREE_OPERATOR_HPP
+
+// --- External Includes ---
+#include "Eigen/Sparse"
+#include "Eigen/IterativeLinearSolvers"
+
+// --- FEM Includes ---
+#include "packages/graph/inc/MatrixFreeOperator.hpp"
+
+
+namespace cie::fem {
+
+
+template <class TValue, concepts::UnsignedInteger TDoFIndex = std::size_t>
+class EigenMatrixFreeOperator;
+
+
+} // namespace cie::fem
+
+
+namespace Eigen::internal {
+
+
+/// @brief Let Eigen treat the matrix-free operator like a sparse matrix.
+template <class TValue, cie::concepts::UnsignedInteger TDoFIndex>
+struct traits<cie::fem::EigenMatrixFreeOperator<TValue,TDoFIndex>>
+    : public traits<Eigen::SparseMatrix<TValue>>
+{};
+
+
+} // namespace Eigen::internal
+
+
+namespace cie::fem {
+
+
+/// @brief Adaptor exposing a @ref MatrixFreeOperator to Eigen's iterative solvers.
+/// @details Only the product with dense vectors is supported, which is all that
+///          Eigen::ConjugateGradient (with @a Eigen::Lower|Eigen::Upper) and other
+///          Krylov solvers require. Pair it with @ref MatrixFreeJacobiPreconditioner,
+///          since Eigen's own preconditioners access the entries of the matrix.
+/// @code
+/// const EigenMatrixFreeOperator<double> adaptor(matrixFreeOperator);
+/// Eigen::ConjugateGradient<EigenMatrixFreeOperator<double>,
+///                          Eigen::Lower|Eigen::Upper,
+///                          MatrixFreeJacobiPreconditioner<double>> solver;
+/// solver.compute(adaptor);
+/// @endcode
+/// @note The adaptor must outlive the solver it is passed to, and the wrapped
+///       operator must outlive the adaptor.
+template <class TValue, concepts::UnsignedInteger TDoFIndex>
+class EigenMatrixFreeOperator : public Eigen::EigenBase<EigenMatrixFreeOperator<TValue,TDoFIndex>>
+{
+public:
+    using Scalar = TValue;
+
+    using RealScalar = typename Eigen::NumTraits<TValue>::Real;
+
+    using StorageIndex = int;
+
+    using Vector = Eigen::Matrix<TValue,Eigen::Dynamic,1>;
+
+    enum
+    {
+        ColsAtCompileTime = Eigen::Dynamic,
+        MaxColsAtCompileTime = Eigen::Dynamic,
+        IsRowMajor = false
+    };
+
+    template <class TRhs>
+    using ProductExpression = Eigen::Product<EigenMatrixFreeOperator,TRhs,Eigen::AliasFreeProduct>;
+
+public:
+    /// @param rOperator Operator to wrap. Its diagonal is computed at construction.
+    explicit EigenMatrixFreeOperator(Ref<const MatrixFreeOperator<TValue,TDoFIndex>> rOperator);
+
+    Eigen::Index rows() const noexcept;
+
+    Eigen::Index cols() const noexcept;
+
+    template <class TRhs>
+    ProductExpression<TRhs> operator*(const Eigen::MatrixBase<TRhs>& rRhs) const
+    {
+        return ProductExpression<TRhs>(*this, rRhs.derived());
+    }
+
+    /// @brief Diagonal of the wrapped operator (see @ref MatrixFreeOperator::diagonal).
+    Ref<const Vector> diagonal() const noexcept;
+
+    /// @brief Compute the product with a contiguous vector of @ref cols components.
+    /// @returns A view of the product, valid until the next call.
+    Eigen::Map<const Vector> product(Ptr<const TValue> pInput) const;
+
+private:
+    Ptr<const MatrixFreeOperator<TValue,TDoFIndex>> _pOperator;
+
+    Vector _diagonal;
+
+    /// @brief Product of the operator, reused across calls.
+    mutable DynamicArray<TValue> _buffer;
+}; // class EigenMatrixFreeOperator
+
+
+/// @brief Jacobi preconditioner for @ref EigenMatrixFreeOperator.
+/// @details Same as Eigen::DiagonalPreconditioner, except that the diagonal is
+///          requested from the operator instead of being read from its entries.
+template <class TValue>
+class MatrixFreeJacobiPreconditioner : public Eigen::DiagonalPreconditioner<TValue>
+{
+private:
+    using Base = Eigen::DiagonalPreconditioner<TValue>;
+
+public:
+    MatrixFreeJacobiPreconditioner() = default;
+
+    template <class TMatrix>
+    explicit MatrixFreeJacobiPreconditioner(const TMatrix& rMatrix)
+        : Base()
+    {
+        this->compute(rMatrix);
+    }
+
+    template <class TMatrix>
+    MatrixFreeJacobiPreconditioner& analyzePattern(const TMatrix&)
+    {
+        return *this;
+    }
+
+    template <class TMatrix>
+    MatrixFreeJacobiPreconditioner& factorize(const TMatrix& rMatrix)
+    {
+        const auto& rDiagonal = rMatrix.diagonal();
+        Base::m_invdiag.resize(rDiagonal.size());
+        for (Eigen::Index iRow=0; iRow<rDiagonal.size(); ++iRow) {
+            Base::m_invdiag(iRow) = rDiagonal(iRow) == TValue(0) ? TValue(1) : TValue(1) / rDiagonal(iRow);
+        }
+        Base::m_isInitialized = true;
+        return *this;
+    }
+
+    template <class TMatrix>
+    MatrixFreeJacobiPreconditioner& compute(const TMatrix& rMatrix)
+    {
+        return this->factorize(rMatrix);
+    }
+}; // class MatrixFreeJacobiPreconditioner
+
+
+} // namespace cie::fem
+
+#include "packages/graph/impl/EigenMatrixFreeOperator_impl.hpp"
+
+#endif
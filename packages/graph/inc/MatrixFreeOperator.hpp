@@ -0,0 +1,128 @@
+#ifndef CIE_FEM_MATRIX_FREE_OPERATOR_HPP
+#define CIE_FEM_MATRIX_FREE_OPERATOR_HPP
+
+// --- FEM Includes ---
+#include "packages/graph/inc/Assembler.hpp"
+
+// --- Utility Includes ---
+#include "packages/stl_extension/inc/DynamicArray.hpp"
+#include "packages/stl_extension/inc/OptionalRef.hpp"
+#include "packages/concurrency/inc/ThreadPoolBase.hpp"
+
+// --- STL Includes ---
+#include <functional> // function
+#include <span> // span
+
+
+namespace cie::fem {
+
+
+/// @brief Linear operator that applies cell contributions on the fly instead of assembling a matrix.
+/// @details The product @f$ y = A x @f$ is computed by gathering the coefficients of each cell's DoFs
+///          from @a x, applying the cell's local operator to them, and scattering the result back into
+///          @a y. Only the DoF map of the @ref BasicAssembler "assembler" is stored, which makes the
+///          operator an alternative to an assembled CSR matrix when memory bandwidth is the bottleneck.
+///
+///          With a thread pool, cells are processed color by color (see @ref BasicAssembler::makeColoring),
+///          with the cells of each color split into one chunk per thread. The local vectors and scratch
+///          space of each chunk are allocated once at construction, so a single operator must not compute
+///          several products concurrently.
+///
+///          If the assembler was @ref BasicAssembler::condense "condensed", the operator only acts on
+///          free DoFs: constrained DoFs are neither gathered nor scattered, so it represents the free
+///          block of the matrix, like the CSR matrices the assembler constructs in that case. Contributions
+///          of the prescribed values are moved to the right hand side with @ref liftConstraints.
+/// @tparam TValue Scalar type of the vectors.
+/// @tparam TDoFIndex DoF index type of the assembler.
+template <class TValue, concepts::UnsignedInteger TDoFIndex = std::size_t>
+class MatrixFreeOperator
+{
+public:
+    using Value = TValue;
+
+    /// @brief Functor applying a cell's local operator.
+    /// @details Signature:
+    ///          @code
+    ///          void(VertexID cellID, Ptr<const TValue> pLocalInput, Ptr<TValue> pLocalOutput, std::span<TValue> buffer)
+    ///          @endcode
+    ///          Local vectors are ordered like the cell's DoFs in the assembler, and the output must be
+    ///          overwritten. @a buffer is scratch space of the size requested at construction, private
+    ///          to the calling thread. The kernel is invoked concurrently if a thread pool is provided.
+    using CellKernel = std::function<void(VertexID,Ptr<const TValue>,Ptr<TValue>,std::span<TValue>)>;
+
+    using Assembler = BasicAssembler<TDoFIndex>;
+
+public:
+    /// @param rAssembler Assembler holding the DoF map. It must outlive the operator and must not
+    ///                   add cells after the operator is constructed.
+    /// @param rCellKernel Functor applying a cell's local operator (see @ref CellKernel).
+    /// @param bufferSize Size of the scratch space passed to the cell kernel.
+    /// @param rThreadPool Optional thread pool to apply cell operators in parallel.
+    MatrixFreeOperator(Ref<const Assembler> rAssembler,
+                       CellKernel&& rCellKernel,
+                       std::size_t bufferSize = 0ul,
+                       OptionalRef<mp::ThreadPoolBase> rThreadPool = {});
+
+    /// @brief Compute the product of the operator with a vector.
+    /// @param pInput Vector to multiply, with @ref size components.
+    /// @param pOutput Vector to overwrite with the product, with @ref size components.
+    void product(Ptr<const TValue> pInput, Ptr<TValue> pOutput) const;
+
+    /// @brief Move the contributions of constrained DoFs to the right hand side of a condensed system.
+    /// @param rConstrainedValues Prescribed values constructed by @ref BasicAssembler::condense.
+    /// @param pRhs Right hand side with @ref size components, from which the product of the
+    ///             free-constrained block of the operator and the prescribed values is subtracted.
+    void liftConstraints(Ref<const DynamicArray<TValue>> rConstrainedValues, Ptr<TValue> pRhs) const;
+
+    /// @brief Compute the diagonal of the operator, for example for a Jacobi preconditioner.
+    /// @param pDiagonal Vector to overwrite with the diagonal, with @ref size components.
+    /// @details Each cell kernel is applied to the unit vectors of the cell's free DoFs, so this is
+    ///          as expensive as a number of products equal to the largest local size.
+    void diagonal(Ptr<TValue> pDiagonal) const;
+
+    /// @brief Number of rows and columns of the operator, which is the number of free DoFs.
+    std::size_t size() const noexcept;
+
+private:
+    /// @brief Gather the local input of each cell, apply its kernel and scatter its local output.
+    /// @param rGather Functor writing the local input, with the signature
+    ///                @code void(std::size_t iLocal, TDoFIndex iDoF, Ref<TValue> rLocalInput) @endcode
+    /// @param rScatter Functor consuming the local output, with the signature
+    ///                 @code void(std::size_t iLocal, TDoFIndex iDoF, TValue localOutput) @endcode
+    /// @details Cells are processed color by color if operating in parallel.
+    template <class TGather, class TScatter>
+    void apply(TGather&& rGather, TScatter&& rScatter) const;
+
+    /// @brief Invoke a functor on each cell along with the buffer of the chunk the cell belongs to.
+    /// @param rFunction Functor with the signature @code void(std::size_t iCell, Ptr<TValue> pBuffer) @endcode
+    ///                  The buffer holds the local input, the local output, and the kernel's scratch space.
+    template <class TFunction>
+    void forEachCell(TFunction&& rFunction) const;
+
+    /// @brief Size of the buffer of a single chunk.
+    std::size_t getChunkBufferSize() const noexcept;
+
+    Ptr<const Assembler> _pAssembler;
+
+    CellKernel _cellKernel;
+
+    std::size_t _bufferSize;
+
+    OptionalRef<mp::ThreadPoolBase> _threadPool;
+
+    /// @brief Coloring of the cells, only computed when operating in parallel.
+    typename Assembler::Coloring _coloring;
+
+    /// @brief Largest number of DoFs of any cell.
+    std::size_t _maxLocalSize;
+
+    /// @brief Local vectors and scratch space of each chunk, reused across products.
+    mutable DynamicArray<TValue> _buffers;
+}; // class MatrixFreeOperator
+
+
+} // namespace cie::fem
+
+#include "packages/graph/impl/MatrixFreeOperator_impl.hpp"
+
+#endif
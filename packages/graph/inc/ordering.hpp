@@ -0,0 +1,76 @@
+#ifndef CIE_FEM_GRAPH_ORDERING_HPP
+#define CIE_FEM_GRAPH_ORDERING_HPP
+
+// --- Utility Includes ---
+#include "packages/stl_extension/inc/DynamicArray.hpp"
+#include "packages/types/inc/types.hpp"
+
+// --- STL Includes ---
+#include <span> // span
+#include <cstddef> // size_t
+
+
+namespace cie::fem {
+
+
+/// @brief Algorithms for reordering the rows and columns of a sparse matrix.
+enum class DoFOrdering
+{
+    /// @brief Reverse Cuthill-McKee, reducing the bandwidth and profile.
+    ReverseCuthillMcKee,
+    /// @brief Recursive bisection on level set separators, reducing fill-in for direct solvers.
+    NestedDissection
+}; // enum class DoFOrdering
+
+
+/// @brief Measures of how far the nonzeros of a sparse matrix are spread from its diagonal.
+struct SparsityStatistics
+{
+    /// @brief Largest distance between a nonzero and the diagonal.
+    std::size_t bandwidth;
+
+    /// @brief Sum of the distances between the first nonzero of each row and the diagonal.
+    std::size_t profile;
+}; // struct SparsityStatistics
+
+
+/// @brief Compute the bandwidth and profile of a CSR sparsity pattern.
+SparsityStatistics getSparsityStatistics(std::span<const std::size_t> rowExtents,
+                                         std::span<const std::size_t> columnIndices);
+
+
+/** @brief Compute a reverse Cuthill-McKee ordering of a symmetric sparsity pattern.
+ *  @details Each connected component is traversed breadth-first from a pseudo-peripheral
+ *           vertex, visiting neighbours in order of increasing degree, and the resulting
+ *           order is reversed.
+ *  @param rowExtents Row extents of the CSR pattern.
+ *  @param columnIndices Column indices of the CSR pattern.
+ *  @param rOrder Output array of old row indices in their new order, i.e.: row
+ *                @a rOrder[i] is moved to position @a i.
+ */
+void makeReverseCuthillMcKeeOrdering(std::span<const std::size_t> rowExtents,
+                                     std::span<const std::size_t> columnIndices,
+                                     Ref<DynamicArray<std::size_t>> rOrder);
+
+
+/** @brief Compute a nested dissection ordering of a symmetric sparsity pattern.
+ *  @details The graph is recursively split by the middle level set of a breadth-first
+ *           traversal from a pseudo-peripheral vertex. The parts are ordered first, followed
+ *           by their separator, which confines the fill-in of a factorization to the
+ *           separators. Parts with fewer than @a leafSize vertices are not split further.
+ *  @param rowExtents Row extents of the CSR pattern.
+ *  @param columnIndices Column indices of the CSR pattern.
+ *  @param rOrder Output array of old row indices in their new order, i.e.: row
+ *                @a rOrder[i] is moved to position @a i.
+ *  @param leafSize Size below which parts are not dissected further.
+ */
+void makeNestedDissectionOrdering(std::span<const std::size_t> rowExtents,
+                                  std::span<const std::size_t> columnIndices,
+                                  Ref<DynamicArray<std::size_t>> rOrder,
+                                  std::size_t leafSize = 64);
+
+
+} // namespace cie::fem
+
+
+#endif
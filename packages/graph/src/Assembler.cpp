@@ -1,26 +1,208 @@
 // --- FEM Includes ---
 #include "packages/graph/inc/Assembler.hpp"
+#include "packages/graph/inc/ordering.hpp"
+
+// --- Utility Includes ---
+#include "packages/macros/inc/exceptions.hpp"
+
+// --- STL Includes ---
+#include <limits> // numeric_limits
+#include <algorithm> // none_of, max
+#include <numeric> // iota
+#include <cstdint> // std::uint32_t
 
 
 namespace cie::fem {
 
 
-Assembler::Assembler() noexcept
-    : _dofCounter(0)
+template <concepts::UnsignedInteger TDoFIndex>
+BasicAssembler<TDoFIndex>::BasicAssembler() noexcept
+    : BasicAssembler(0)
 {
 }
 
 
-Assembler::Assembler(std::size_t dofBegin) noexcept
-    : _dofCounter(dofBegin)
+template <concepts::UnsignedInteger TDoFIndex>
+BasicAssembler<TDoFIndex>::BasicAssembler(std::size_t dofBegin) noexcept
+    : _dofCounter(dofBegin),
+      _componentCount(1ul),
+      _constrainedDoFCount(0ul),
+      _cellIndices(),
+      _cellIDs(),
+      _dofExtents({0ul}),
+      _dofIndices()
 {
 }
 
 
-std::size_t Assembler::dofCount() const noexcept
+template <concepts::UnsignedInteger TDoFIndex>
+BasicAssembler<TDoFIndex>::BasicAssembler(std::size_t dofBegin, std::size_t componentCount)
+    : _dofCounter(dofBegin),
+      _componentCount(componentCount),
+      _constrainedDoFCount(0ul),
+      _cellIndices(),
+      _cellIDs(),
+      _dofExtents({0ul}),
+      _dofIndices()
+{
+    CIE_CHECK(0ul < componentCount, "Nodes must have at least one component")
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+std::size_t BasicAssembler<TDoFIndex>::dofCount() const noexcept
 {
     return _dofCounter;
 }
 
 
+template <concepts::UnsignedInteger TDoFIndex>
+std::size_t BasicAssembler<TDoFIndex>::freeDoFCount() const noexcept
+{
+    return _dofCounter - _constrainedDoFCount;
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+std::size_t BasicAssembler<TDoFIndex>::componentCount() const noexcept
+{
+    return _componentCount;
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+std::size_t BasicAssembler<TDoFIndex>::cellCount() const noexcept
+{
+    return _cellIDs.size();
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+std::size_t BasicAssembler<TDoFIndex>::getCellIndex(VertexID cellID) const
+{
+    const auto it = _cellIndices.find(cellID);
+    CIE_OUT_OF_RANGE_CHECK(it != _cellIndices.end(), "cell " << cellID << " is not registered in the assembler")
+    return it->second;
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+VertexID BasicAssembler<TDoFIndex>::getCellID(std::size_t iCell) const
+{
+    CIE_OUT_OF_RANGE_CHECK(iCell < _cellIDs.size())
+    return _cellIDs[iCell];
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+std::span<const TDoFIndex> BasicAssembler<TDoFIndex>::getDoFs(std::size_t iCell) const
+{
+    CIE_OUT_OF_RANGE_CHECK(iCell + 1 < _dofExtents.size())
+    return std::span<const TDoFIndex>(_dofIndices.data() + _dofExtents[iCell],
+                                      _dofIndices.data() + _dofExtents[iCell + 1]);
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+std::span<TDoFIndex> BasicAssembler<TDoFIndex>::getMutableDoFs(std::size_t iCell) noexcept
+{
+    return std::span<TDoFIndex>(_dofIndices.data() + _dofExtents[iCell],
+                                _dofIndices.data() + _dofExtents[iCell + 1]);
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+void BasicAssembler<TDoFIndex>::makeColoring(Ref<Coloring> rColoring) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const std::size_t cellCount = this->cellCount();
+    rColoring.cells.clear();
+    rColoring.colorExtents.clear();
+    rColoring.cells.reserve(cellCount);
+    rColoring.colorExtents.push_back(0ul);
+    rColoring.maxLocalSize = 0ul;
+
+    // Each DoF stores the last color it was claimed by. Cells are added
+    // to the current color if none of their DoFs have been claimed in it
+    // yet, and the remaining cells are deferred to the next color.
+    constexpr std::size_t unclaimed = std::numeric_limits<std::size_t>::max();
+    DynamicArray<std::size_t> dofColors(_dofCounter, unclaimed);
+
+    DynamicArray<std::size_t> pending(cellCount), deferred;
+    std::iota(pending.begin(), pending.end(), 0ul);
+
+    for (std::size_t iColor=0ul; !pending.empty(); ++iColor) {
+        deferred.clear();
+        for (const std::size_t iCell : pending) {
+            const auto dofs = this->getDoFs(iCell);
+            const bool isFree = std::none_of(dofs.begin(),
+                                             dofs.end(),
+                                             [&dofColors, iColor](TDoFIndex iDoF) {
+                                                return dofColors[iDoF] == iColor;
+                                             });
+            if (isFree) {
+                for (const TDoFIndex iDoF : dofs) dofColors[iDoF] = iColor;
+                rColoring.cells.push_back(iCell);
+                rColoring.maxLocalSize = std::max(rColoring.maxLocalSize, dofs.size());
+            } else {
+                deferred.push_back(iCell);
+            }
+        } // for iCell in pending
+        rColoring.colorExtents.push_back(rColoring.cells.size());
+        pending.swap(deferred);
+    } // for iColor while pending
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <concepts::UnsignedInteger TDoFIndex>
+std::pair<SparsityStatistics,SparsityStatistics>
+BasicAssembler<TDoFIndex>::renumber(DoFOrdering ordering)
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    CIE_CHECK(_constrainedDoFCount == 0ul, "Cannot renumber the DoFs of a condensed assembler")
+    DynamicArray<std::size_t> rowExtents, columnIndices;
+    this->makeSparsityPattern(rowExtents, columnIndices, false, {});
+    const SparsityStatistics before = getSparsityStatistics(rowExtents, columnIndices);
+
+    DynamicArray<std::size_t> order;
+    switch (ordering) {
+        case DoFOrdering::ReverseCuthillMcKee:
+            makeReverseCuthillMcKeeOrdering(rowExtents, columnIndices, order);
+            break;
+        case DoFOrdering::NestedDissection:
+            makeNestedDissectionOrdering(rowExtents, columnIndices, order);
+            break;
+        default:
+            CIE_THROW(Exception, "Unsupported DoF ordering: " << static_cast<int>(ordering))
+    }
+
+    // Indices that are not in use have empty rows. Assign the indices
+    // in use to the DoFs in their new order, skipping the unused ones.
+    const auto isUsed = [&rowExtents](std::size_t iDoF) {return rowExtents[iDoF] != rowExtents[iDoF + 1];};
+    DynamicArray<TDoFIndex> newIndices(order.size(), _invalidDoF);
+    std::size_t iNew = 0ul;
+    for (const std::size_t iOld : order) {
+        if (!isUsed(iOld)) continue;
+        while (!isUsed(iNew)) ++iNew;
+        newIndices[iOld] = static_cast<TDoFIndex>(iNew++);
+    }
+    for (TDoFIndex& riDoF : _dofIndices) riDoF = newIndices[riDoF];
+
+    this->makeSparsityPattern(rowExtents, columnIndices, false, {});
+    return std::make_pair(before, getSparsityStatistics(rowExtents, columnIndices));
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template class BasicAssembler<std::uint32_t>;
+
+
+template class BasicAssembler<std::size_t>;
+
+
 } // namespace cie::fem
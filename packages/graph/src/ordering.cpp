@@ -0,0 +1,290 @@
+// --- FEM Includes ---
+#include "packages/graph/inc/ordering.hpp"
+
+// --- Utility Includes ---
+#include "packages/macros/inc/exceptions.hpp"
+#include "packages/macros/inc/checks.hpp"
+
+// --- STL Includes ---
+#include <algorithm> // min_element, sort, reverse, max
+#include <limits> // numeric_limits
+
+
+namespace cie::fem {
+
+
+namespace {
+
+
+/// @brief Breadth-first level structure of a connected subgraph.
+/// @details The subgraph consists of the vertices carrying a specific label.
+class LevelStructure
+{
+public:
+    LevelStructure(std::span<const std::size_t> rowExtents,
+                   std::span<const std::size_t> columnIndices)
+        : _rowExtents(rowExtents),
+          _columnIndices(columnIndices),
+          _stamps(rowExtents.size() - 1, 0ul),
+          _stamp(0ul),
+          _vertices(),
+          _levelExtents()
+    {
+    }
+
+    /// @brief Traverse the vertices labeled @a label that are reachable from @a root.
+    void build(std::size_t root,
+               std::span<const std::size_t> labels,
+               std::size_t label)
+    {
+        ++_stamp;
+        _vertices.clear();
+        _levelExtents.assign(1, 0ul);
+        _vertices.push_back(root);
+        _stamps[root] = _stamp;
+
+        while (_levelExtents.back() < _vertices.size()) {
+            const std::size_t iBegin = _levelExtents.back();
+            const std::size_t iEnd = _vertices.size();
+            _levelExtents.push_back(iEnd);
+            for (std::size_t i=iBegin; i<iEnd; ++i) {
+                const std::size_t iVertex = _vertices[i];
+                for (std::size_t iEntry=_rowExtents[iVertex]; iEntry<_rowExtents[iVertex + 1]; ++iEntry) {
+                    const std::size_t iNeighbor = _columnIndices[iEntry];
+                    if (labels[iNeighbor] == label && _stamps[iNeighbor] != _stamp) {
+                        _stamps[iNeighbor] = _stamp;
+                        _vertices.push_back(iNeighbor);
+                    }
+                }
+            } // for i in range(iBegin, iEnd)
+        } // while the last level is not empty
+    }
+
+    /// @brief Find a pseudo-peripheral vertex of the subgraph containing @a root, and build the level structure from it.
+    /// @details Starts from the vertex of minimum degree and hops to the vertex of minimum
+    ///          degree in the last level as long as that increases the depth (George-Liu).
+    std::size_t buildFromPeripheral(std::size_t root,
+                                    std::span<const std::size_t> labels,
+                                    std::size_t label)
+    {
+        this->build(root, labels, label);
+        root = this->getMinDegreeVertex(_vertices);
+        this->build(root, labels, label);
+
+        while (true) {
+            const std::size_t candidate = this->getMinDegreeVertex(this->getLevel(this->depth() - 1));
+            const std::size_t depth = this->depth();
+            this->build(candidate, labels, label);
+            if (depth < this->depth()) {
+                root = candidate;
+            } else {
+                this->build(root, labels, label);
+                return root;
+            }
+        }
+    }
+
+    std::size_t depth() const noexcept
+    {
+        return _levelExtents.size() - 1;
+    }
+
+    std::span<const std::size_t> getLevel(std::size_t iLevel) const noexcept
+    {
+        return std::span<const std::size_t>(_vertices.data() + _levelExtents[iLevel],
+                                             _vertices.data() + _levelExtents[iLevel + 1]);
+    }
+
+    std::span<const std::size_t> vertices() const noexcept
+    {
+        return _vertices;
+    }
+
+    std::size_t getDegree(std::size_t iVertex) const noexcept
+    {
+        return _rowExtents[iVertex + 1] - _rowExtents[iVertex];
+    }
+
+private:
+    std::size_t getMinDegreeVertex(std::span<const std::size_t> vertices) const noexcept
+    {
+        return *std::min_element(vertices.begin(),
+                                 vertices.end(),
+                                 [this](std::size_t iLeft, std::size_t iRight) {
+                                    return this->getDegree(iLeft) < this->getDegree(iRight);
+                                 });
+    }
+
+    std::span<const std::size_t> _rowExtents;
+
+    std::span<const std::size_t> _columnIndices;
+
+    /// @brief Last traversal each vertex was visited in.
+    DynamicArray<std::size_t> _stamps;
+
+    std::size_t _stamp;
+
+    DynamicArray<std::size_t> _vertices;
+
+    DynamicArray<std::size_t> _levelExtents;
+}; // class LevelStructure
+
+
+/// @brief Recursively dissect a connected subgraph and append its vertices to the ordering.
+void dissect(Ref<LevelStructure> rLevels,
+             std::size_t root,
+             std::size_t label,
+             Ref<DynamicArray<std::size_t>> rLabels,
+             Ref<std::size_t> rLabelCounter,
+             Ref<DynamicArray<std::size_t>> rOrder,
+             std::size_t leafSize)
+{
+    constexpr std::size_t ordered = std::numeric_limits<std::size_t>::max();
+
+    rLevels.buildFromPeripheral(root, rLabels, label);
+    const DynamicArray<std::size_t> vertices(rLevels.vertices().begin(), rLevels.vertices().end());
+
+    // Small or shallow subgraphs are ordered as they were traversed
+    if (vertices.size() < leafSize || rLevels.depth() < 3) {
+        for (const std::size_t iVertex : vertices) {
+            rLabels[iVertex] = ordered;
+            rOrder.push_back(iVertex);
+        }
+        return;
+    }
+
+    // Remove the middle level, which separates the subgraph into at least two parts
+    const auto middleLevel = rLevels.getLevel(rLevels.depth() / 2);
+    const DynamicArray<std::size_t> separator(middleLevel.begin(), middleLevel.end());
+    for (const std::size_t iVertex : separator) rLabels[iVertex] = ordered;
+
+    // Label the connected parts of the remaining subgraph
+    DynamicArray<std::pair<std::size_t,std::size_t>> parts;
+    for (const std::size_t iVertex : vertices) {
+        if (rLabels[iVertex] == label) {
+            const std::size_t partLabel = rLabelCounter++;
+            rLevels.build(iVertex, rLabels, label);
+            for (const std::size_t iPartVertex : rLevels.vertices()) rLabels[iPartVertex] = partLabel;
+            parts.emplace_back(iVertex, partLabel);
+        }
+    } // for iVertex in vertices
+
+    for (const auto& [iPartRoot, partLabel] : parts) {
+        dissect(rLevels, iPartRoot, partLabel, rLabels, rLabelCounter, rOrder, leafSize);
+    }
+
+    rOrder.insert(rOrder.end(), separator.begin(), separator.end());
+}
+
+
+} // unnamed namespace
+
+
+SparsityStatistics getSparsityStatistics(std::span<const std::size_t> rowExtents,
+                                         std::span<const std::size_t> columnIndices)
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    SparsityStatistics statistics {0ul, 0ul};
+    const std::size_t rowCount = rowExtents.empty() ? 0ul : rowExtents.size() - 1;
+
+    for (std::size_t iRow=0ul; iRow<rowCount; ++iRow) {
+        std::size_t iFirstColumn = iRow;
+        for (std::size_t iEntry=rowExtents[iRow]; iEntry<rowExtents[iRow + 1]; ++iEntry) {
+            const std::size_t iColumn = columnIndices[iEntry];
+            iFirstColumn = std::min(iFirstColumn, iColumn);
+            statistics.bandwidth = std::max(statistics.bandwidth,
+                                            iColumn < iRow ? iRow - iColumn : iColumn - iRow);
+        }
+        statistics.profile += iRow - iFirstColumn;
+    } // for iRow in range(rowCount)
+
+    return statistics;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+void makeReverseCuthillMcKeeOrdering(std::span<const std::size_t> rowExtents,
+                                     std::span<const std::size_t> columnIndices,
+                                     Ref<DynamicArray<std::size_t>> rOrder)
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    rOrder.clear();
+    if (rowExtents.size() < 2) return;
+    const std::size_t rowCount = rowExtents.size() - 1;
+    rOrder.reserve(rowCount);
+
+    // Unordered vertices are labeled 0, ordered ones 1
+    DynamicArray<std::size_t> labels(rowCount, 0ul);
+    LevelStructure levels(rowExtents, columnIndices);
+    DynamicArray<std::size_t> neighbors;
+
+    for (std::size_t iComponent=0ul; iComponent<rowCount; ++iComponent) {
+        if (labels[iComponent]) continue;
+
+        const std::size_t root = levels.buildFromPeripheral(iComponent, labels, 0ul);
+        labels[root] = 1ul;
+        rOrder.push_back(root);
+
+        // Cuthill-McKee: visit unordered neighbors in order of increasing degree
+        for (std::size_t iHead=rOrder.size()-1; iHead<rOrder.size(); ++iHead) {
+            const std::size_t iVertex = rOrder[iHead];
+            neighbors.clear();
+            for (std::size_t iEntry=rowExtents[iVertex]; iEntry<rowExtents[iVertex + 1]; ++iEntry) {
+                const std::size_t iNeighbor = columnIndices[iEntry];
+                if (!labels[iNeighbor]) {
+                    labels[iNeighbor] = 1ul;
+                    neighbors.push_back(iNeighbor);
+                }
+            }
+            std::sort(neighbors.begin(),
+                      neighbors.end(),
+                      [&levels](std::size_t iLeft, std::size_t iRight) {
+                        const std::size_t leftDegree = levels.getDegree(iLeft);
+                        const std::size_t rightDegree = levels.getDegree(iRight);
+                        return leftDegree < rightDegree || (leftDegree == rightDegree && iLeft < iRight);
+                      });
+            rOrder.insert(rOrder.end(), neighbors.begin(), neighbors.end());
+        } // for iHead in range(rOrder.size())
+    } // for iComponent in range(rowCount)
+
+    std::reverse(rOrder.begin(), rOrder.end());
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+void makeNestedDissectionOrdering(std::span<const std::size_t> rowExtents,
+                                  std::span<const std::size_t> columnIndices,
+                                  Ref<DynamicArray<std::size_t>> rOrder,
+                                  std::size_t leafSize)
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    rOrder.clear();
+    if (rowExtents.size() < 2) return;
+    const std::size_t rowCount = rowExtents.size() - 1;
+    rOrder.reserve(rowCount);
+
+    // Each vertex is labeled with the part it currently belongs to.
+    // All vertices start out in part 0 and each connected component
+    // is dissected separately.
+    DynamicArray<std::size_t> labels(rowCount, 0ul);
+    std::size_t labelCounter = 1ul;
+    LevelStructure levels(rowExtents, columnIndices);
+
+    for (std::size_t iComponent=0ul; iComponent<rowCount; ++iComponent) {
+        if (labels[iComponent] == 0ul) {
+            dissect(levels, iComponent, 0ul, labels, labelCounter, rOrder, leafSize);
+        }
+    }
+
+    CIE_CHECK(rOrder.size() == rowCount, "Nested dissection ordered " << rOrder.size() << " of " << rowCount << " vertices")
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+} // namespace cie::fem
@@ -7,6 +7,7 @@
 #include "packages/maths/inc/AnsatzSpace.hpp"
 #include "packages/graph/inc/OrientedBoundary.hpp"
 #include "packages/graph/inc/connectivity.hpp"
+#include "packages/numeric/inc/DirichletConstraints.hpp"
 #include <packages/io/inc/MatrixMarket.hpp>
 #include <packages/macros/inc/exceptions.hpp>
 
@@ -125,6 +126,177 @@ CIE_TEST_CASE("Assembler", "[graph]")
     CIE_TEST_CHECK(assembler[3][1] == assembler[4][1]);
     CIE_TEST_CHECK(assembler[4][0] == assembler[5][0]);
 
+    // Check dense cell indexing
+    CIE_TEST_REQUIRE(assembler.cellCount() == 6);
+    for (std::size_t iCell=0ul; iCell<assembler.cellCount(); ++iCell) {
+        const VertexID cellID = assembler.getCellID(iCell);
+        CIE_TEST_CHECK(assembler.getCellIndex(cellID) == iCell);
+        CIE_TEST_CHECK(std::ranges::equal(assembler.getDoFs(iCell), assembler[cellID]));
+    }
+
+    // A narrower DoF index type must yield the same DoF map
+    {
+        BasicAssembler<std::uint32_t> narrowAssembler;
+        narrowAssembler.addGraph(mesh, dofCounter, dofMatcher);
+        CIE_TEST_CHECK(narrowAssembler.dofCount() == assembler.dofCount());
+        for (const auto& [cellID, rDoFs] : assembler.items()) {
+            CIE_TEST_CHECK(std::ranges::equal(narrowAssembler[cellID], rDoFs));
+        }
+    }
+
+    // Parallel numbering may order DoFs differently, but must yield the same connectivities
+    {
+        mp::ThreadPoolBase threadPool(2);
+        Assembler parallelAssembler;
+        parallelAssembler.addGraph(mesh, dofCounter, dofMatcher, threadPool);
+        CIE_TEST_CHECK(parallelAssembler.dofCount() == assembler.dofCount());
+        for (const auto& [leftID, rLeftDoFs] : assembler.items()) {
+            for (const auto& [rightID, rRightDoFs] : assembler.items()) {
+                for (std::size_t iLeft=0ul; iLeft<rLeftDoFs.size(); ++iLeft) {
+                    for (std::size_t iRight=0ul; iRight<rRightDoFs.size(); ++iRight) {
+                        CIE_TEST_CHECK((rLeftDoFs[iLeft] == rRightDoFs[iRight])
+                                       == (parallelAssembler[leftID][iLeft] == parallelAssembler[rightID][iRight]));
+                    }
+                }
+            }
+        }
+    }
+
+    // Sparsity patterns built in parallel must match the serial ones, and must not hold on to excess capacity
+    {
+        mp::ThreadPoolBase threadPool(4);
+        for (const bool upperTriangle : {false, true}) {
+            int rowCount, columnCount, parallelRowCount, parallelColumnCount;
+            DynamicArray<int> rowExtents, columnIndices, parallelRowExtents, parallelColumnIndices;
+            DynamicArray<float> entries, parallelEntries;
+            if (upperTriangle) {
+                assembler.makeSymmetricCSRMatrix(rowCount, columnCount, rowExtents, columnIndices, entries);
+                assembler.makeSymmetricCSRMatrix(parallelRowCount, parallelColumnCount, parallelRowExtents, parallelColumnIndices, parallelEntries, threadPool);
+            } else {
+                assembler.makeCSRMatrix(rowCount, columnCount, rowExtents, columnIndices, entries);
+                assembler.makeCSRMatrix(parallelRowCount, parallelColumnCount, parallelRowExtents, parallelColumnIndices, parallelEntries, threadPool);
+            }
+            CIE_TEST_CHECK(parallelRowCount == rowCount);
+            CIE_TEST_CHECK(parallelColumnCount == columnCount);
+            CIE_TEST_CHECK(parallelRowExtents == rowExtents);
+            CIE_TEST_CHECK(parallelColumnIndices == columnIndices);
+            CIE_TEST_CHECK(columnIndices.capacity() == columnIndices.size());
+            CIE_TEST_CHECK(parallelColumnIndices.capacity() == parallelColumnIndices.size());
+        }
+    }
+
+    // Renumbering permutes DoF indices, but must preserve connectivities
+    for (const DoFOrdering ordering : {DoFOrdering::ReverseCuthillMcKee, DoFOrdering::NestedDissection}) {
+        Assembler renumbered;
+        renumbered.addGraph(mesh, dofCounter, dofMatcher);
+        const auto [before, after] = renumbered.renumber(ordering);
+        CIE_TEST_CHECK(renumbered.dofCount() == assembler.dofCount());
+        CIE_TEST_CHECK(0ul < before.bandwidth);
+        CIE_TEST_CHECK(after.bandwidth < renumbered.dofCount());
+        if (ordering == DoFOrdering::ReverseCuthillMcKee) CIE_TEST_CHECK(after.profile <= before.profile);
+        for (const auto& [leftID, rLeftDoFs] : assembler.items()) {
+            for (const auto& [rightID, rRightDoFs] : assembler.items()) {
+                for (std::size_t iLeft=0ul; iLeft<rLeftDoFs.size(); ++iLeft) {
+                    for (std::size_t iRight=0ul; iRight<rRightDoFs.size(); ++iRight) {
+                        CIE_TEST_CHECK((rLeftDoFs[iLeft] == rRightDoFs[iRight])
+                                       == (renumbered[leftID][iLeft] == renumbered[rightID][iRight]));
+                    }
+                }
+            }
+        }
+    }
+
+    // Condensation must yield the free block of the system with constraints imposed by elimination
+    {
+        const std::size_t localSize = pAnsatzSpace->size();
+        DynamicArray<float> localMatrix(localSize * localSize);
+        for (std::size_t iEntry=0ul; iEntry<localMatrix.size(); ++iEntry) {
+            localMatrix[iEntry] = 1.0f + (iEntry / localSize) + 2.0f * (iEntry % localSize);
+        }
+        const DynamicArray<float> localVector(localSize, 1.0f);
+
+        DirichletConstraints<float> constraints(assembler.dofCount());
+        constraints.addConstraint(assembler[0][0], 1.0f);
+        constraints.addConstraint(assembler[1][2], -2.0f);
+        constraints.addConstraint(assembler[5][3], 3.0f);
+
+        // Reference: full system with constraints imposed afterwards
+        int rowCount, columnCount;
+        DynamicArray<int> rowExtents, columnIndices;
+        DynamicArray<float> entries;
+        assembler.makeCSRMatrix(rowCount, columnCount, rowExtents, columnIndices, entries);
+        DynamicArray<float> rhs(rowCount, 0.0f);
+        for (const auto cellID : assembler.keys()) {
+            assembler.assemble(cellID, localMatrix.data(), rowExtents, columnIndices, entries);
+            assembler.assemble(cellID, localVector.data(), rhs);
+        }
+        constraints.apply(rowExtents, columnIndices, entries, rhs.data());
+
+        Assembler condensed;
+        condensed.addGraph(mesh, dofCounter, dofMatcher);
+        DynamicArray<float> constrainedValues;
+        CIE_TEST_REQUIRE(condensed.condense(constraints, constrainedValues) == 9ul);
+        CIE_TEST_CHECK(condensed.dofCount() == 12ul);
+        CIE_TEST_CHECK(condensed.freeDoFCount() == 9ul);
+        CIE_TEST_CHECK(constrainedValues.size() == 3ul);
+        CIE_TEST_CHECK_THROWS(condensed.addGraph(mesh, dofCounter, dofMatcher));
+        CIE_TEST_CHECK_THROWS(condensed.renumber(DoFOrdering::ReverseCuthillMcKee));
+
+        int reducedRowCount, reducedColumnCount;
+        DynamicArray<int> reducedRowExtents, reducedColumnIndices;
+        DynamicArray<float> reducedEntries;
+        CIE_TEST_REQUIRE_NOTHROW(condensed.makeCSRMatrix(reducedRowCount,
+                                                         reducedColumnCount,
+                                                         reducedRowExtents,
+                                                         reducedColumnIndices,
+                                                         reducedEntries));
+        CIE_TEST_REQUIRE(reducedRowCount == 9);
+        CIE_TEST_CHECK(reducedColumnCount == 9);
+        DynamicArray<float> reducedRhs(reducedRowCount, 0.0f);
+        for (const auto cellID : condensed.keys()) {
+            CIE_TEST_CHECK_NOTHROW(condensed.assemble(cellID,
+                                                      localMatrix.data(),
+                                                      reducedRowExtents,
+                                                      reducedColumnIndices,
+                                                      reducedEntries,
+                                                      constrainedValues,
+                                                      reducedRhs));
+            CIE_TEST_CHECK_NOTHROW(condensed.assemble(cellID, localVector.data(), reducedRhs));
+        }
+
+        // Map the original DoF indices to the condensed ones
+        DynamicArray<std::size_t> newIndices(assembler.dofCount());
+        for (const auto& [cellID, rDoFs] : assembler.items()) {
+            for (std::size_t iLocal=0ul; iLocal<rDoFs.size(); ++iLocal) newIndices[rDoFs[iLocal]] = condensed[cellID][iLocal];
+        }
+
+        for (int iRow=0; iRow<rowCount; ++iRow) {
+            if (constraints.isConstrained(iRow)) {
+                CIE_TEST_REQUIRE(static_cast<int>(newIndices[iRow]) >= reducedRowCount);
+                CIE_TEST_CHECK(constrainedValues[newIndices[iRow] - reducedRowCount] == constraints.getValue(iRow));
+                continue;
+            }
+            const int iReducedRow = newIndices[iRow];
+            CIE_TEST_CHECK(reducedRhs[iReducedRow] == Approx(rhs[iRow]));
+            for (int iEntry=rowExtents[iRow]; iEntry<rowExtents[iRow + 1]; ++iEntry) {
+                if (constraints.isConstrained(columnIndices[iEntry])) continue;
+                const int iReducedColumn = newIndices[columnIndices[iEntry]];
+                const auto itBegin = reducedColumnIndices.begin() + reducedRowExtents[iReducedRow];
+                const auto itEnd = reducedColumnIndices.begin() + reducedRowExtents[iReducedRow + 1];
+                const auto it = std::find(itBegin, itEnd, iReducedColumn);
+                CIE_TEST_REQUIRE(it != itEnd);
+                CIE_TEST_CHECK(reducedEntries[std::distance(reducedColumnIndices.begin(), it)] == Approx(entries[iEntry]));
+            }
+        }
+
+        // Expanding must append the prescribed values to the free components
+        DynamicArray<float> expanded(condensed.dofCount());
+        CIE_TEST_CHECK_NOTHROW(condensed.expand(reducedRhs.data(), constrainedValues, expanded.data()));
+        for (std::size_t iDoF=0ul; iDoF<expanded.size(); ++iDoF) {
+            CIE_TEST_CHECK(expanded[newIndices[iDoF]] == Approx(rhs[iDoF]));
+        }
+    }
+
     {
         int rowCount, columnCount;
         DynamicArray<int> rowExtents, columnIndices;
@@ -142,6 +314,212 @@ CIE_TEST_CASE("Assembler", "[graph]")
                                   rowExtents.data(),
                                   columnIndices.data(),
                                   entries.data()));
+
+        // Scatter a local matrix of ones from every cell => each entry
+        // must end up with the number of cells sharing its row and column DoFs.
+        const DynamicArray<float> localMatrix(pAnsatzSpace->size() * pAnsatzSpace->size(), 1.0f);
+        const DynamicArray<float> localVector(pAnsatzSpace->size(), 1.0f);
+        DynamicArray<float> rhs(rowCount, 0.0f);
+        for (const auto cellID : assembler.keys()) {
+            CIE_TEST_CHECK_NOTHROW(assembler.assemble(cellID,
+                                                      localMatrix.data(),
+                                                      rowExtents,
+                                                      columnIndices,
+                                                      entries));
+            CIE_TEST_CHECK_NOTHROW(assembler.assemble(cellID, localVector.data(), rhs));
+        }
+
+        for (int iRow=0; iRow<rowCount; ++iRow) {
+            int rowSharingCount = 0;
+            for (const auto& rDoFs : assembler.values())
+                rowSharingCount += std::ranges::count(rDoFs, static_cast<std::size_t>(iRow));
+            CIE_TEST_CHECK(rhs[iRow] == Approx(rowSharingCount));
+
+            for (int iEntry=rowExtents[iRow]; iEntry<rowExtents[iRow + 1]; ++iEntry) {
+                int sharingCount = 0;
+                for (const auto& rDoFs : assembler.values()) {
+                    sharingCount += std::ranges::count(rDoFs, static_cast<std::size_t>(iRow))
+                                  * std::ranges::count(rDoFs, static_cast<std::size_t>(columnIndices[iEntry]));
+                }
+                CIE_TEST_CHECK(entries[iEntry] == Approx(sharingCount));
+            }
+        }
+
+        // Repeat the assembly through a slot map
+        int slotRowCount, slotColumnCount;
+        DynamicArray<int> slotRowExtents, slotColumnIndices;
+        DynamicArray<float> slotEntries;
+        Assembler::SlotMap<int> slotMap;
+        CIE_TEST_REQUIRE_NOTHROW(assembler.makeCSRMatrix(slotRowCount,
+                                                         slotColumnCount,
+                                                         slotRowExtents,
+                                                         slotColumnIndices,
+                                                         slotEntries,
+                                                         slotMap));
+        CIE_TEST_REQUIRE(slotRowExtents == rowExtents);
+        CIE_TEST_REQUIRE(slotColumnIndices == columnIndices);
+        CIE_TEST_CHECK(slotMap.slots.size() == assembler.keys().size() * localMatrix.size());
+
+        for (const auto cellID : assembler.keys()) {
+            CIE_TEST_CHECK_NOTHROW(assembler.assemble(cellID,
+                                                      localMatrix.data(),
+                                                      slotMap,
+                                                      slotEntries));
+        }
+        CIE_TEST_CHECK(slotEntries == entries);
+
+        // Color the cells and check that no color contains cells that share a DoF
+        Assembler::Coloring coloring;
+        CIE_TEST_REQUIRE_NOTHROW(assembler.makeColoring(coloring));
+        CIE_TEST_REQUIRE(coloring.cells.size() == assembler.keys().size());
+        CIE_TEST_REQUIRE(1 < coloring.colorExtents.size());
+        CIE_TEST_CHECK(coloring.colorExtents.front() == 0ul);
+        CIE_TEST_CHECK(coloring.colorExtents.back() == coloring.cells.size());
+        CIE_TEST_CHECK(coloring.maxLocalSize == pAnsatzSpace->size());
+
+        for (std::size_t iColor=0ul; iColor+1<coloring.colorExtents.size(); ++iColor) {
+            DynamicArray<std::size_t> colorDoFs;
+            for (std::size_t iCell=coloring.colorExtents[iColor]; iCell<coloring.colorExtents[iColor + 1]; ++iCell) {
+                const auto dofs = assembler.getDoFs(coloring.cells[iCell]);
+                colorDoFs.insert(colorDoFs.end(), dofs.begin(), dofs.end());
+            }
+            std::sort(colorDoFs.begin(), colorDoFs.end());
+            CIE_TEST_CHECK(std::adjacent_find(colorDoFs.begin(), colorDoFs.end()) == colorDoFs.end());
+        }
+
+        // Assemble by colors
+        std::fill(slotEntries.begin(), slotEntries.end(), 0.0f);
+        const auto cellKernel = [&localMatrix]([[maybe_unused]] VertexID cellID, Ptr<float> pLocalMatrix) {
+            std::copy(localMatrix.begin(), localMatrix.end(), pLocalMatrix);
+        };
+        CIE_TEST_CHECK_NOTHROW(assembler.assemble(coloring, cellKernel, slotMap, slotEntries));
+        CIE_TEST_CHECK(slotEntries == entries);
+
+        // Assemble by colors into a persistent buffer, which is only allocated once
+        {
+            mp::ThreadPoolBase threadPool(3);
+            DynamicArray<float> buffer;
+            std::fill(slotEntries.begin(), slotEntries.end(), 0.0f);
+            CIE_TEST_CHECK_NOTHROW(assembler.assemble(coloring, cellKernel, slotMap, slotEntries, buffer, threadPool));
+            CIE_TEST_CHECK(slotEntries == entries);
+            CIE_TEST_CHECK(buffer.size() == threadPool.size() * localMatrix.size());
+
+            const Ptr<const float> pBuffer = buffer.data();
+            std::fill(slotEntries.begin(), slotEntries.end(), 0.0f);
+            CIE_TEST_CHECK_NOTHROW(assembler.assemble(coloring, cellKernel, slotMap, slotEntries, buffer, threadPool));
+            CIE_TEST_CHECK(slotEntries == entries);
+            CIE_TEST_CHECK(buffer.data() == pBuffer);
+        }
+
+        // The symmetric matrix must hold the upper triangle of the full one
+        int symmetricRowCount, symmetricColumnCount;
+        DynamicArray<int> symmetricRowExtents, symmetricColumnIndices;
+        DynamicArray<float> symmetricEntries;
+        CIE_TEST_REQUIRE_NOTHROW(assembler.makeSymmetricCSRMatrix(symmetricRowCount,
+                                                                  symmetricColumnCount,
+                                                                  symmetricRowExtents,
+                                                                  symmetricColumnIndices,
+                                                                  symmetricEntries));
+        CIE_TEST_CHECK(symmetricRowCount == rowCount);
+        CIE_TEST_CHECK(symmetricColumnCount == columnCount);
+        CIE_TEST_REQUIRE(symmetricEntries.size() == (entries.size() + rowCount) / 2);
+
+        for (const auto cellID : assembler.keys()) {
+            CIE_TEST_CHECK_NOTHROW(assembler.assembleSymmetric(cellID,
+                                                               localMatrix.data(),
+                                                               symmetricRowExtents,
+                                                               symmetricColumnIndices,
+                                                               symmetricEntries));
+        }
+
+        DynamicArray<float> upperEntries;
+        for (int iRow=0; iRow<rowCount; ++iRow) {
+            for (int iEntry=rowExtents[iRow]; iEntry<rowExtents[iRow + 1]; ++iEntry) {
+                if (iRow <= columnIndices[iEntry]) {
+                    CIE_TEST_CHECK(symmetricColumnIndices[upperEntries.size()] == columnIndices[iEntry]);
+                    upperEntries.push_back(entries[iEntry]);
+                }
+            }
+            CIE_TEST_CHECK(static_cast<std::size_t>(symmetricRowExtents[iRow + 1]) == upperEntries.size());
+        }
+        CIE_TEST_CHECK(symmetricEntries == upperEntries);
+
+        // Repeat the symmetric assembly through a slot map
+        Assembler::SlotMap<int> symmetricSlotMap;
+        CIE_TEST_REQUIRE_NOTHROW(assembler.makeSymmetricCSRMatrix(symmetricRowCount,
+                                                                  symmetricColumnCount,
+                                                                  symmetricRowExtents,
+                                                                  symmetricColumnIndices,
+                                                                  symmetricEntries,
+                                                                  symmetricSlotMap));
+        CIE_TEST_CHECK(std::ranges::count(symmetricSlotMap.slots, Assembler::SlotMap<int>::skip)
+                       == static_cast<std::ptrdiff_t>(assembler.keys().size() * (localMatrix.size() - pAnsatzSpace->size()) / 2));
+        CIE_TEST_CHECK_NOTHROW(assembler.assemble(coloring, cellKernel, symmetricSlotMap, symmetricEntries));
+        CIE_TEST_CHECK(symmetricEntries == upperEntries);
+
+        // Lumping must yield the row sums of the assembled matrix
+        DynamicArray<float> lumped(rowCount, 0.0f);
+        for (const auto cellID : assembler.keys()) {
+            CIE_TEST_CHECK_NOTHROW(assembler.assembleLumped(cellID, localMatrix.data(), lumped));
+        }
+        for (int iRow=0; iRow<rowCount; ++iRow) {
+            float rowSum = 0.0f;
+            for (int iEntry=rowExtents[iRow]; iEntry<rowExtents[iRow + 1]; ++iEntry) rowSum += entries[iEntry];
+            CIE_TEST_CHECK(lumped[iRow] == Approx(rowSum));
+        }
+
+        // Block mode with 2 components per node must reproduce the scalar pattern,
+        // with each scalar entry expanded to a dense 2x2 block.
+        constexpr std::size_t componentCount = 2;
+        Assembler blockAssembler(0, componentCount);
+        blockAssembler.addGraph(mesh, dofCounter, dofMatcher);
+        CIE_TEST_CHECK(blockAssembler.componentCount() == componentCount);
+
+        int blockRowCount, blockColumnCount;
+        DynamicArray<int> blockRowExtents, blockColumnIndices;
+        DynamicArray<float> blockEntries;
+        CIE_TEST_REQUIRE_NOTHROW(blockAssembler.makeBSRMatrix(blockRowCount,
+                                                              blockColumnCount,
+                                                              blockRowExtents,
+                                                              blockColumnIndices,
+                                                              blockEntries));
+        CIE_TEST_CHECK(blockRowCount == rowCount);
+        CIE_TEST_CHECK(blockColumnCount == columnCount);
+        CIE_TEST_REQUIRE(blockRowExtents == rowExtents);
+        CIE_TEST_REQUIRE(blockColumnIndices == columnIndices);
+        CIE_TEST_REQUIRE(blockEntries.size() == entries.size() * componentCount * componentCount);
+
+        // The local matrix' entries only depend on the components they couple
+        const std::size_t localBlockSize = pAnsatzSpace->size() * componentCount;
+        DynamicArray<float> localBlockMatrix(localBlockSize * localBlockSize);
+        for (std::size_t iLocalRow=0ul; iLocalRow<localBlockSize; ++iLocalRow) {
+            for (std::size_t iLocalColumn=0ul; iLocalColumn<localBlockSize; ++iLocalColumn) {
+                localBlockMatrix[iLocalRow * localBlockSize + iLocalColumn] = 1.0f + (iLocalRow % componentCount) * componentCount + iLocalColumn % componentCount;
+            }
+        }
+        const DynamicArray<float> localBlockVector(localBlockSize, 1.0f);
+        DynamicArray<float> blockRHS(rowCount * componentCount, 0.0f);
+
+        for (const auto cellID : blockAssembler.keys()) {
+            CIE_TEST_CHECK_NOTHROW(blockAssembler.assembleBlock(cellID,
+                                                                localBlockMatrix.data(),
+                                                                blockRowExtents,
+                                                                blockColumnIndices,
+                                                                blockEntries));
+            CIE_TEST_CHECK_NOTHROW(blockAssembler.assembleBlock(cellID, localBlockVector.data(), blockRHS));
+        }
+
+        for (std::size_t iBlock=0ul; iBlock<entries.size(); ++iBlock) {
+            for (std::size_t iComponent=0ul; iComponent<componentCount; ++iComponent) {
+                for (std::size_t jComponent=0ul; jComponent<componentCount; ++jComponent) {
+                    CIE_TEST_CHECK(blockEntries[(iBlock * componentCount + iComponent) * componentCount + jComponent]
+                                   == Approx(entries[iBlock] * (1.0f + iComponent * componentCount + jComponent)));
+                }
+            }
+        }
+        for (std::size_t iEntry=0ul; iEntry<blockRHS.size(); ++iEntry) {
+            CIE_TEST_CHECK(blockRHS[iEntry] == Approx(rhs[iEntry / componentCount]));
+        }
     }
 } // CIE_TEST_CASE "Assembler"
 
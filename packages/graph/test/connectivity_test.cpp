@@ -6,8 +6,14 @@
 // --- FEM Includes ---
 #include "packages/graph/inc/connectivity.hpp"
 #include "packages/maths/inc/AnsatzSpace.hpp"
+#include "packages/maths/inc/ReducedAnsatzSpace.hpp"
+#include "packages/maths/inc/IntegratedLegendrePolynomial.hpp"
 #include "packages/maths/inc/Polynomial.hpp"
 
+// --- STL Includes ---
+#include <algorithm> // find, sort
+#include <utility> // pair
+
 
 namespace cie::fem {
 
@@ -514,4 +520,83 @@ CIE_TEST_CASE("AnsatzMap", "[graph]")
 }
 
 
+CIE_TEST_CASE("ReducedAnsatzSpace connectivity", "[graph]")
+{
+    CIE_TEST_CASE_INIT("ReducedAnsatzSpace connectivity")
+
+    // Cubic serendipity quad: 4 vertex and 8 edge functions, 4 of which live on each boundary
+    using Basis = maths::IntegratedLegendrePolynomial<double>;
+    const unsigned polynomialOrder = 3u;
+    const unsigned setSize = polynomialOrder + 1u;
+    const maths::AnsatzSpace<Basis,2> full(Basis::makeSet(polynomialOrder));
+    const maths::ReducedAnsatzSpace<Basis,2> reduced(full, maths::makeSerendipityIndices<2>(setSize, polynomialOrder));
+    CIE_TEST_REQUIRE(reduced.size() == 12u);
+
+    const auto getComponent = [&reduced](unsigned i, unsigned j) -> Size {
+        const auto it = std::find(reduced.indices().begin(),
+                                  reduced.indices().end(),
+                                  StaticArray<unsigned,2> {i, j});
+        CIE_TEST_REQUIRE(it != reduced.indices().end());
+        return std::distance(reduced.indices().begin(), it);
+    };
+
+    const DynamicArray<double> samples {-1.0, -0.5, 0.0, 0.5, 1.0};
+
+    // N_0 is the only scalar function that doesn't vanish at -1, and N_1 at +1
+    {
+        CIE_TEST_CASE_INIT("scanConnectivities")
+        DynamicArray<std::pair<BoundaryID,Size>> connectivities;
+        scanConnectivities(reduced,
+                           [&connectivities](BoundaryID boundary, Size iComponent) {
+                                connectivities.emplace_back(boundary, iComponent);
+                           },
+                           samples.data(),
+                           samples.data() + samples.size(),
+                           1e-10);
+        CIE_TEST_CHECK(connectivities.size() == 4u * setSize);
+
+        for (unsigned j=0u; j<setSize; ++j) {
+            const auto contains = [&connectivities](BoundaryID boundary, Size iComponent) -> bool {
+                return std::find(connectivities.begin(),
+                                 connectivities.end(),
+                                 std::make_pair(boundary, iComponent)) != connectivities.end();
+            };
+            CIE_TEST_CHECK(contains(BoundaryID("-x"), getComponent(0u, j)));
+            CIE_TEST_CHECK(contains(BoundaryID("+x"), getComponent(1u, j)));
+            CIE_TEST_CHECK(contains(BoundaryID("-y"), getComponent(j, 0u)));
+            CIE_TEST_CHECK(contains(BoundaryID("+y"), getComponent(j, 1u)));
+        }
+    }
+
+    // Two cells sharing a boundary, the second of which is mirrored along the boundary normal,
+    // so that the shared boundary is the +x (or +y) boundary in both cells' local axes. Functions
+    // must then match their counterparts with the same index, including the odd cubic bubbles.
+    {
+        CIE_TEST_CASE_INIT("AnsatzMap")
+        const auto ansatzMap = makeAnsatzMap(reduced, samples, utils::Comparison<double>(1e-10, 1e-8));
+
+        DynamicArray<std::pair<Size,Size>> pairs, expectedPairs;
+        ansatzMap.getPairs(OrientedBoundary<2>("+x+y", "+x"),
+                           OrientedBoundary<2>("-x+y", "+x"),
+                           std::back_inserter(pairs));
+        for (unsigned j=0u; j<setSize; ++j) expectedPairs.emplace_back(getComponent(1u, j), getComponent(1u, j));
+        std::sort(pairs.begin(), pairs.end());
+        std::sort(expectedPairs.begin(), expectedPairs.end());
+        CIE_TEST_CHECK(pairs == expectedPairs);
+        CIE_TEST_CHECK(ansatzMap.getPairCount(OrientedBoundary<2>("+x+y", "+x"),
+                                              OrientedBoundary<2>("-x+y", "+x")) == setSize);
+
+        pairs.clear();
+        expectedPairs.clear();
+        ansatzMap.getPairs(OrientedBoundary<2>("+x+y", "+y"),
+                           OrientedBoundary<2>("+x-y", "+y"),
+                           std::back_inserter(pairs));
+        for (unsigned i=0u; i<setSize; ++i) expectedPairs.emplace_back(getComponent(i, 1u), getComponent(i, 1u));
+        std::sort(pairs.begin(), pairs.end());
+        std::sort(expectedPairs.begin(), expectedPairs.end());
+        CIE_TEST_CHECK(pairs == expectedPairs);
+    }
+}
+
+
 } // namespace cie::fem
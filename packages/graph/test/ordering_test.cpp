@@ -0,0 +1,179 @@
+// --- Utility Includes ---
+#include "packages/testing/inc/essentials.hpp"
+#include "packages/stl_extension/inc/DynamicArray.hpp"
+
+// --- FEM Includes ---
+#include "packages/graph/inc/ordering.hpp"
+
+// --- STL Includes ---
+#include <algorithm> // sort, is_permutation
+#include <numeric> // iota
+#include <set> // set
+
+
+namespace cie::fem {
+
+
+namespace {
+
+
+/// @brief Build the 5-point stencil pattern of an n x n grid, with rows numbered in the provided order.
+void makeGridPattern(std::size_t n,
+                     Ref<const DynamicArray<std::size_t>> rNumbering,
+                     Ref<DynamicArray<std::size_t>> rRowExtents,
+                     Ref<DynamicArray<std::size_t>> rColumnIndices)
+{
+    DynamicArray<DynamicArray<std::size_t>> rows(n * n);
+    for (std::size_t j=0ul; j<n; ++j) {
+        for (std::size_t i=0ul; i<n; ++i) {
+            auto& rRow = rows[rNumbering[j * n + i]];
+            rRow.push_back(rNumbering[j * n + i]);
+            if (0ul < i) rRow.push_back(rNumbering[j * n + i - 1]);
+            if (i + 1 < n) rRow.push_back(rNumbering[j * n + i + 1]);
+            if (0ul < j) rRow.push_back(rNumbering[(j - 1) * n + i]);
+            if (j + 1 < n) rRow.push_back(rNumbering[(j + 1) * n + i]);
+        }
+    }
+
+    rRowExtents.assign(1, 0ul);
+    rColumnIndices.clear();
+    for (auto& rRow : rows) {
+        std::sort(rRow.begin(), rRow.end());
+        rColumnIndices.insert(rColumnIndices.end(), rRow.begin(), rRow.end());
+        rRowExtents.push_back(rColumnIndices.size());
+    }
+}
+
+
+/// @brief Renumber a pattern such that row @a rOrder[i] becomes row @a i.
+void permute(Ref<const DynamicArray<std::size_t>> rOrder,
+             Ref<DynamicArray<std::size_t>> rRowExtents,
+             Ref<DynamicArray<std::size_t>> rColumnIndices)
+{
+    DynamicArray<std::size_t> newIndices(rOrder.size());
+    for (std::size_t iNew=0ul; iNew<rOrder.size(); ++iNew) newIndices[rOrder[iNew]] = iNew;
+
+    DynamicArray<std::size_t> rowExtents {0ul}, columnIndices;
+    for (const std::size_t iOld : rOrder) {
+        const auto rowBegin = columnIndices.size();
+        for (std::size_t iEntry=rRowExtents[iOld]; iEntry<rRowExtents[iOld + 1]; ++iEntry) {
+            columnIndices.push_back(newIndices[rColumnIndices[iEntry]]);
+        }
+        std::sort(columnIndices.begin() + rowBegin, columnIndices.end());
+        rowExtents.push_back(columnIndices.size());
+    }
+
+    rRowExtents = std::move(rowExtents);
+    rColumnIndices = std::move(columnIndices);
+}
+
+
+/// @brief Count the nonzeros below the diagonal of the Cholesky factor of a symmetric pattern.
+/// @details The structure of each column of the factor is the union of the pattern below the
+///          diagonal and the structures of its children in the elimination tree.
+std::size_t getCholeskyFill(Ref<const DynamicArray<std::size_t>> rRowExtents,
+                            Ref<const DynamicArray<std::size_t>> rColumnIndices)
+{
+    const std::size_t rowCount = rRowExtents.size() - 1;
+    DynamicArray<std::set<std::size_t>> columns(rowCount);
+    for (std::size_t iRow=0ul; iRow<rowCount; ++iRow) {
+        for (std::size_t iEntry=rRowExtents[iRow]; iEntry<rRowExtents[iRow + 1]; ++iEntry) {
+            if (iRow < rColumnIndices[iEntry]) columns[iRow].insert(rColumnIndices[iEntry]);
+        }
+    }
+
+    std::size_t fill = 0ul;
+    for (std::size_t iColumn=0ul; iColumn<rowCount; ++iColumn) {
+        auto& rColumn = columns[iColumn];
+        fill += rColumn.size();
+        if (!rColumn.empty()) {
+            // Merge into the parent, which is the first row below the diagonal
+            const std::size_t iParent = *rColumn.begin();
+            rColumn.erase(rColumn.begin());
+            columns[iParent].insert(rColumn.begin(), rColumn.end());
+        }
+    } // for iColumn in range(rowCount)
+
+    return fill;
+}
+
+
+} // unnamed namespace
+
+
+CIE_TEST_CASE("ordering", "[graph]")
+{
+    CIE_TEST_CASE_INIT("ordering")
+
+    // Number the grid with a stride coprime to its size, scattering neighbors
+    const std::size_t n = 16;
+    DynamicArray<std::size_t> numbering(n * n);
+    for (std::size_t i=0ul; i<n*n; ++i) numbering[i] = (i * 37) % (n * n);
+
+    DynamicArray<std::size_t> rowExtents, columnIndices;
+    makeGridPattern(n, numbering, rowExtents, columnIndices);
+    const SparsityStatistics scattered = getSparsityStatistics(rowExtents, columnIndices);
+
+    DynamicArray<std::size_t> identity(n * n);
+    std::iota(identity.begin(), identity.end(), 0ul);
+
+    {
+        CIE_TEST_CASE_INIT("statistics")
+        DynamicArray<std::size_t> naturalExtents, naturalIndices;
+        makeGridPattern(n, identity, naturalExtents, naturalIndices);
+        const SparsityStatistics natural = getSparsityStatistics(naturalExtents, naturalIndices);
+        CIE_TEST_CHECK(natural.bandwidth == n);
+        CIE_TEST_CHECK(natural.profile == (n - 1) * (n * n + 1));
+    }
+
+    {
+        CIE_TEST_CASE_INIT("reverse Cuthill-McKee")
+        DynamicArray<std::size_t> order;
+        makeReverseCuthillMcKeeOrdering(rowExtents, columnIndices, order);
+        CIE_TEST_REQUIRE(order.size() == n * n);
+        CIE_TEST_CHECK(std::is_permutation(order.begin(), order.end(), identity.begin()));
+
+        DynamicArray<std::size_t> permutedExtents(rowExtents), permutedIndices(columnIndices);
+        permute(order, permutedExtents, permutedIndices);
+        const SparsityStatistics permuted = getSparsityStatistics(permutedExtents, permutedIndices);
+
+        // Starting from a corner, level sets are anti-diagonals of at most n vertices
+        CIE_TEST_CHECK(permuted.bandwidth <= n);
+        CIE_TEST_CHECK(permuted.profile < scattered.profile);
+    }
+
+    {
+        CIE_TEST_CASE_INIT("nested dissection")
+        DynamicArray<std::size_t> order;
+        makeNestedDissectionOrdering(rowExtents, columnIndices, order, 8);
+        CIE_TEST_REQUIRE(order.size() == n * n);
+        CIE_TEST_CHECK(std::is_permutation(order.begin(), order.end(), identity.begin()));
+
+        // Numbering the separators last must factorize with less fill than the natural order
+        DynamicArray<std::size_t> naturalExtents, naturalIndices;
+        makeGridPattern(n, identity, naturalExtents, naturalIndices);
+
+        DynamicArray<std::size_t> permutedExtents(rowExtents), permutedIndices(columnIndices);
+        permute(order, permutedExtents, permutedIndices);
+        CIE_TEST_CHECK(getCholeskyFill(permutedExtents, permutedIndices) < getCholeskyFill(naturalExtents, naturalIndices));
+    }
+
+    {
+        CIE_TEST_CASE_INIT("disconnected")
+        // Two isolated vertices and a pair
+        const DynamicArray<std::size_t> extents {0ul, 1ul, 3ul, 5ul, 6ul};
+        const DynamicArray<std::size_t> indices {0ul, 1ul, 2ul, 1ul, 2ul, 3ul};
+        DynamicArray<std::size_t> order;
+
+        makeReverseCuthillMcKeeOrdering(extents, indices, order);
+        CIE_TEST_REQUIRE(order.size() == 4);
+        CIE_TEST_CHECK(std::is_permutation(order.begin(), order.end(), identity.begin()));
+
+        makeNestedDissectionOrdering(extents, indices, order);
+        CIE_TEST_REQUIRE(order.size() == 4);
+        CIE_TEST_CHECK(std::is_permutation(order.begin(), order.end(), identity.begin()));
+    }
+}
+
+
+} // namespace cie::fem
@@ -17,34 +17,55 @@ namespace cie::fem::maths {
 
 
 template <class TScalarExpression, unsigned Dim>
-inline void AnsatzSpaceDerivative<TScalarExpression,Dim>::evaluate(ConstIterator itArgumentBegin,
-                                                                   ConstIterator itArgumentEnd,
-                                                                   Iterator itOut) const
+inline Ptr<const typename AnsatzSpaceDerivative<TScalarExpression,Dim>::Value>
+AnsatzSpaceDerivative<TScalarExpression,Dim>::tabulate(ConstIterator itArgumentBegin,
+                                                       ConstIterator itArgumentEnd) const
 {
-    const unsigned setSize = _ansatzSet.size();
-    CIE_OUT_OF_RANGE_CHECK(setSize == _derivativeSet.size())
+    const unsigned setSize = _pAnsatzSet->size();
     CIE_OUT_OF_RANGE_CHECK(std::distance(itArgumentBegin, itArgumentEnd) == Dim)
 
-    Ref<IndexBuffer> rIndexBuffer      = _buffer.template get<0>();
-    Ref<ValueBuffer> rValueBuffer      = _buffer.template get<1>();
-    Ref<ValueBuffer> rDerivativeBuffer = _buffer.template get<2>();
+    // Use the provided buffer if there is one, and fall back to thread-local storage otherwise
+    Ptr<Value> pScratch = _buffer.data();
+    if (_buffer.empty()) {
+        Ref<ValueBuffer> rScratch = _pThreadBuffers->template get<0>();
+        if (rScratch.size() < this->getMinBufferSize()) rScratch.resize(this->getMinBufferSize());
+        pScratch = rScratch.data();
+    }
 
     // Fill the value and derivative buffers
     {
-        Ptr<Value> pValue      = rValueBuffer.data();
-        Ptr<Value> pDerivative = rDerivativeBuffer.data();
+        Ptr<Value> pValue      = pScratch;
+        Ptr<Value> pDerivative = pScratch + Dim * setSize;
 
         for (auto it=itArgumentBegin; it!=itArgumentEnd; ++it) {
-            const auto itEnd = it + 1;
-            for (const auto& rScalarExpression : _ansatzSet) {
-                rScalarExpression.evaluate(it, itEnd, pValue++);
-            } // for scalarExpression in ansatzSet
-            for (const auto& rScalarExpression : _derivativeSet) {
-                rScalarExpression.evaluate(it, itEnd, pDerivative++);
-            } // for scalarExpression in derivativeSet
+            if constexpr (HasSetEvaluation) {
+                TScalarExpression::evaluateSetDerivatives(*_pAnsatzSet, *it, pValue, pDerivative);
+                pValue += setSize;
+                pDerivative += setSize;
+            } else {
+                for (unsigned iFunction=0u; iFunction<setSize; ++iFunction) {
+                    this->evaluateScalar(iFunction, it, *pValue++, *pDerivative++);
+                } // for iFunction in range(setSize)
+            }
         } // for component in arguments
     } // fill the value and derivative buffers
 
+    return pScratch;
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+inline void AnsatzSpaceDerivative<TScalarExpression,Dim>::evaluate(ConstIterator itArgumentBegin,
+                                                                   ConstIterator itArgumentEnd,
+                                                                   Iterator itOut) const
+{
+    const unsigned setSize = _pAnsatzSet->size();
+    const Ptr<const Value> pValueBuffer = this->tabulate(itArgumentBegin, itArgumentEnd);
+    const Ptr<const Value> pDerivativeBuffer = pValueBuffer + Dim * setSize;
+
+    IndexBuffer indices;
+    std::fill(indices.begin(), indices.end(), 0u);
+
     // Compute the modified outer product
     for (unsigned iDerivative=0; iDerivative<Dim; ++iDerivative) {
         do {
@@ -54,20 +75,95 @@ inline void AnsatzSpaceDerivative<TScalarExpression,Dim>::evaluate(ConstIterator
             // First loop through the value buffer until
             // the derivative index is hit
             for (; iIndex<iDerivative; ++iIndex) {
-                *itOut *= rValueBuffer[rIndexBuffer[iIndex] + iIndex * setSize];
+                *itOut *= pValueBuffer[indices[iIndex] + iIndex * setSize];
             }
 
             // Then, use the derivative
-            *itOut *= rDerivativeBuffer[rIndexBuffer[iIndex] + iIndex * setSize];
+            *itOut *= pDerivativeBuffer[indices[iIndex] + iIndex * setSize];
 
             // Finally, loop through the rest
             // of the value buffer
-            for (++iIndex; iIndex<rIndexBuffer.size(); ++iIndex) {
-                *itOut *= rValueBuffer[rIndexBuffer[iIndex] + iIndex * setSize];
+            for (++iIndex; iIndex<indices.size(); ++iIndex) {
+                *itOut *= pValueBuffer[indices[iIndex] + iIndex * setSize];
             }
 
             ++itOut;
-        } while (OuterProduct<Dim>::next(setSize, rIndexBuffer.begin()));
+        } while (OuterProduct<Dim>::next(setSize, indices.data()));
+    } // for iDerivative in range(Dim)
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+void AnsatzSpaceDerivative<TScalarExpression,Dim>::evaluateBatch(ConstIterator itPointBegin,
+                                                                 unsigned pointCount,
+                                                                 Iterator itOut,
+                                                                 BatchLayout layout) const
+{
+    const unsigned setSize = _pAnsatzSet->size();
+    if (!pointCount || !setSize) return;
+
+    // Tabulate scalar values and derivatives, point by point for each function and axis:
+    // [values on axis 0, ..., values on axis Dim-1, derivatives on axis 0, ...]
+    Ref<ValueBuffer> rTable = _pThreadBuffers->template get<1>();
+    const std::size_t tableSize = 2ul * Dim * setSize * pointCount;
+    const std::size_t tailSize = std::max(pointCount, 2u * setSize);
+    if (rTable.size() < tableSize + tailSize) rTable.resize(tableSize + tailSize);
+
+    {
+        Ptr<Value> pValue      = rTable.data();
+        Ptr<Value> pDerivative = rTable.data() + Dim * setSize * pointCount;
+        for (unsigned iAxis=0u; iAxis<Dim; ++iAxis) {
+            if constexpr (HasSetEvaluation) {
+                // Evaluate the whole set at each point, then scatter it into the rows of the table
+                const Ptr<Value> pSetValues = rTable.data() + tableSize;
+                const Ptr<Value> pSetDerivatives = pSetValues + setSize;
+                for (unsigned iPoint=0u; iPoint<pointCount; ++iPoint) {
+                    TScalarExpression::evaluateSetDerivatives(*_pAnsatzSet, itPointBegin[iPoint * Dim + iAxis], pSetValues, pSetDerivatives);
+                    for (unsigned iFunction=0u; iFunction<setSize; ++iFunction) {
+                        pValue[iFunction * pointCount + iPoint] = pSetValues[iFunction];
+                        pDerivative[iFunction * pointCount + iPoint] = pSetDerivatives[iFunction];
+                    }
+                } // for iPoint in range(pointCount)
+                pValue += setSize * pointCount;
+                pDerivative += setSize * pointCount;
+            } else {
+                for (unsigned iFunction=0u; iFunction<setSize; ++iFunction) {
+                    for (unsigned iPoint=0u; iPoint<pointCount; ++iPoint) {
+                        this->evaluateScalar(iFunction, itPointBegin + iPoint * Dim + iAxis, *pValue++, *pDerivative++);
+                    }
+                } // for iFunction in range(setSize)
+            }
+        } // for iAxis in range(Dim)
+    }
+
+    const Ptr<const Value> pValues = rTable.data();
+    const Ptr<const Value> pDerivatives = pValues + Dim * setSize * pointCount;
+    const Ptr<Value> pProduct = rTable.data() + tableSize;
+    const unsigned basisCount = intPow(setSize, Dim);
+
+    // Walk the cartesian product once per derivative direction, and
+    // multiply the tabulated rows of all points for each ansatz function.
+    IndexBuffer indices;
+    for (unsigned iDerivative=0u; iDerivative<Dim; ++iDerivative) {
+        std::fill(indices.begin(), indices.end(), 0u);
+        unsigned iBasis = 0u;
+        do {
+            const unsigned iComponent = iDerivative * basisCount + iBasis++;
+            const Ptr<Value> pRow = layout == BatchLayout::BasisMajor ? itOut + iComponent * pointCount : pProduct;
+            std::fill(pRow, pRow + pointCount, static_cast<Value>(1));
+            for (unsigned iAxis=0u; iAxis<Dim; ++iAxis) {
+                const Ptr<const Value> pFactors = (iAxis == iDerivative ? pDerivatives : pValues)
+                                                + (iAxis * setSize + indices[iAxis]) * pointCount;
+                for (unsigned iPoint=0u; iPoint<pointCount; ++iPoint) pRow[iPoint] *= pFactors[iPoint];
+            }
+
+            if (layout == BatchLayout::PointMajor) {
+                const unsigned componentCount = this->size();
+                for (unsigned iPoint=0u; iPoint<pointCount; ++iPoint) {
+                    itOut[iPoint * componentCount + iComponent] = pRow[iPoint];
+                }
+            }
+        } while (OuterProduct<Dim>::next(setSize, indices.data()));
     } // for iDerivative in range(Dim)
 }
 
@@ -75,26 +171,59 @@ inline void AnsatzSpaceDerivative<TScalarExpression,Dim>::evaluate(ConstIterator
 template <class TScalarExpression, unsigned Dim>
 unsigned AnsatzSpaceDerivative<TScalarExpression,Dim>::size() const noexcept
 {
-    return intPow(_ansatzSet.size(), Dim) * Dim;
+    return _pAnsatzSet ? intPow(_pAnsatzSet->size(), Dim) * Dim : 0u;
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+unsigned AnsatzSpaceDerivative<TScalarExpression,Dim>::getMinBufferSize() const noexcept
+{
+    return _pAnsatzSet ? 2u * Dim * _pAnsatzSet->size() : 0u;
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+void AnsatzSpaceDerivative<TScalarExpression,Dim>::setBuffer(std::span<Value> buffer)
+{
+    CIE_OUT_OF_RANGE_CHECK(this->getMinBufferSize() <= buffer.size())
+    _buffer = buffer;
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+inline void AnsatzSpaceDerivative<TScalarExpression,Dim>::evaluateScalar(unsigned iFunction,
+                                                                         ConstIterator itArgument,
+                                                                         Ref<Value> rValue,
+                                                                         Ref<Value> rDerivative) const
+{
+    if constexpr (HasFusedDerivatives) {
+        StaticArray<Value,2> valueAndDerivative;
+        (*_pAnsatzSet)[iFunction].evaluateDerivatives(*itArgument, 1u, valueAndDerivative.data());
+        rValue = valueAndDerivative[0];
+        rDerivative = valueAndDerivative[1];
+    } else {
+        CIE_OUT_OF_RANGE_CHECK(iFunction < _pDerivativeSet->size())
+        (*_pAnsatzSet)[iFunction].evaluate(itArgument, itArgument + 1, &rValue);
+        (*_pDerivativeSet)[iFunction].evaluate(itArgument, itArgument + 1, &rDerivative);
+    }
 }
 
 
 template <class TScalarExpression, unsigned Dim>
 AnsatzSpaceDerivative<TScalarExpression,Dim>::AnsatzSpaceDerivative(Ref<const AnsatzSpace<TScalarExpression,Dim>> rAnsatzSpace)
-    : _ansatzSet(rAnsatzSpace._set),
-      _derivativeSet(),
-      _buffer(IndexBuffer(),
-              ValueBuffer(intPow(_ansatzSet.size(), Dim)),
-              ValueBuffer(intPow(_ansatzSet.size(), Dim)))
-{
-    Ref<IndexBuffer> rIndexBuffer = _buffer.template get<0>();
-    std::fill(rIndexBuffer.begin(),
-              rIndexBuffer.end(),
-              0u);
-
-    _derivativeSet.reserve(_ansatzSet.size());
-    for (const auto& rScalarExpression : _ansatzSet) {
-        _derivativeSet.emplace_back(rScalarExpression.makeDerivative());
+    : _pAnsatzSet(rAnsatzSpace._pSet),
+      _pDerivativeSet(),
+      _buffer(),
+      _pThreadBuffers(std::make_shared<ThreadBuffers>())
+{
+    // Scalar functions that evaluate their own derivatives need no separate derivative set
+    if constexpr (!HasFusedDerivatives) {
+        DynamicArray<typename TScalarExpression::Derivative> derivativeSet;
+        derivativeSet.reserve(_pAnsatzSet->size());
+        for (const auto& rScalarExpression : *_pAnsatzSet) {
+            derivativeSet.emplace_back(rScalarExpression.makeDerivative());
+        }
+        _pDerivativeSet = std::make_shared<const DynamicArray<typename TScalarExpression::Derivative>>(std::move(derivativeSet));
     }
 }
 
@@ -108,13 +237,10 @@ AnsatzSpace<TScalarExpression,Dim>::AnsatzSpace() noexcept
 
 template <class TScalarExpression, unsigned Dim>
 AnsatzSpace<TScalarExpression,Dim>::AnsatzSpace(AnsatzSet&& rSet) noexcept
-    : _set(std::move(rSet)),
-      _buffer(IndexBuffer(),
-              ValueBuffer(intPow(_set.size(), Dim)))
+    : _pSet(std::make_shared<const AnsatzSet>(std::move(rSet))),
+      _buffer(),
+      _pThreadBuffers(std::make_shared<ThreadBuffers>())
 {
-    std::fill(_buffer.template get<0>().begin(),
-              _buffer.template get<0>().end(),
-              0u);
 }
 
 
@@ -126,37 +252,130 @@ AnsatzSpace<TScalarExpression,Dim>::AnsatzSpace(const AnsatzSet& rSet)
 
 
 template <class TScalarExpression, unsigned Dim>
-inline void AnsatzSpace<TScalarExpression,Dim>::evaluate(ConstIterator itArgumentBegin,
-                                                         ConstIterator itArgumentEnd,
-                                                         Iterator itOut) const
+inline Ptr<const typename AnsatzSpace<TScalarExpression,Dim>::Value>
+AnsatzSpace<TScalarExpression,Dim>::tabulate(ConstIterator itArgumentBegin,
+                                             ConstIterator itArgumentEnd) const
 {
     CIE_OUT_OF_RANGE_CHECK(std::distance(itArgumentBegin, itArgumentEnd) == Dim)
-    Ref<IndexBuffer> rIndexBuffer = _buffer.template get<0>();
-    Ref<ValueBuffer> rValueBuffer = _buffer.template get<1>();
-
-    // No need to clear the index buffer of its leftover state
-    // (the leftover state is all zeros)
-    //std::fill(rIndexBuffer->begin(), rIndexBuffer->end(), 0);
+    Ref<const AnsatzSet> rSet = *_pSet;
+
+    // Use the provided buffer if there is one, and fall back to thread-local storage otherwise
+    Ptr<Value> pScratch = _buffer.data();
+    if (_buffer.empty()) {
+        Ref<ValueBuffer> rScratch = _pThreadBuffers->template get<0>();
+        if (rScratch.size() < this->getMinBufferSize()) rScratch.resize(this->getMinBufferSize());
+        pScratch = rScratch.data();
+    }
 
     // Fill the value buffer
-    Ptr<Value> pValue = rValueBuffer.data();
+    Ptr<Value> pValue = pScratch;
     for (; itArgumentBegin!=itArgumentEnd; itArgumentBegin++) {
-        for (const auto& rScalarExpression : _set) {
-            rScalarExpression.evaluate(itArgumentBegin,
-                                        itArgumentBegin + 1,
-                                        pValue++);
-        } // for expression in expressions
+        if constexpr (HasSetEvaluation) {
+            TScalarExpression::evaluateSet(rSet, *itArgumentBegin, pValue);
+            pValue += rSet.size();
+        } else {
+            for (const auto& rScalarExpression : rSet) {
+                rScalarExpression.evaluate(itArgumentBegin,
+                                            itArgumentBegin + 1,
+                                            pValue++);
+            } // for expression in expressions
+        }
     } // for argument in arguments
 
-    const unsigned setSize = _set.size();
+    return pScratch;
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+inline void AnsatzSpace<TScalarExpression,Dim>::evaluate(ConstIterator itArgumentBegin,
+                                                         ConstIterator itArgumentEnd,
+                                                         Iterator itOut) const
+{
+    const Ptr<const Value> pValueBuffer = this->tabulate(itArgumentBegin, itArgumentEnd);
+
+    IndexBuffer indices;
+    std::fill(indices.begin(), indices.end(), 0u);
+
+    const unsigned setSize = _pSet->size();
     do {
         // Compute product of bases
         *itOut = static_cast<Value>(1);
-        for (unsigned iIndex=0; iIndex<rIndexBuffer.size(); ++iIndex) {
-            *itOut *= rValueBuffer.at(rIndexBuffer.at(iIndex) + iIndex * setSize);
+        for (unsigned iIndex=0; iIndex<indices.size(); ++iIndex) {
+            *itOut *= pValueBuffer[indices[iIndex] + iIndex * setSize];
         }
         ++itOut;
-    } while (OuterProduct<Dim>::next(setSize, rIndexBuffer.data()));
+    } while (OuterProduct<Dim>::next(setSize, indices.data()));
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+void AnsatzSpace<TScalarExpression,Dim>::evaluateBatch(ConstIterator itPointBegin,
+                                                       unsigned pointCount,
+                                                       Iterator itOut,
+                                                       BatchLayout layout) const
+{
+    Ref<const AnsatzSet> rSet = *_pSet;
+    const unsigned setSize = rSet.size();
+    if (!pointCount || !setSize) return;
+
+    // Tabulate scalar values point by point for each function and axis
+    Ref<ValueBuffer> rTable = _pThreadBuffers->template get<1>();
+    const std::size_t tableSize = Dim * setSize * pointCount;
+    const std::size_t tailSize = std::max(2u * pointCount, setSize);
+    if (rTable.size() < tableSize + tailSize) rTable.resize(tableSize + tailSize);
+
+    Ptr<Value> pTable = rTable.data();
+    for (unsigned iAxis=0u; iAxis<Dim; ++iAxis) {
+        if constexpr (HasBatchEvaluation) {
+            // Gather the axis' coordinates and let each scalar function sweep them at once
+            const Ptr<Value> pCoordinates = rTable.data() + tableSize + pointCount;
+            for (unsigned iPoint=0u; iPoint<pointCount; ++iPoint) pCoordinates[iPoint] = itPointBegin[iPoint * Dim + iAxis];
+            for (const auto& rScalarExpression : rSet) {
+                rScalarExpression.evaluateBatch(pCoordinates, pointCount, pTable);
+                pTable += pointCount;
+            }
+        } else if constexpr (HasSetEvaluation) {
+            // Evaluate the whole set at each point, then scatter it into the rows of the table
+            const Ptr<Value> pSetValues = rTable.data() + tableSize;
+            for (unsigned iPoint=0u; iPoint<pointCount; ++iPoint) {
+                TScalarExpression::evaluateSet(rSet, itPointBegin[iPoint * Dim + iAxis], pSetValues);
+                for (unsigned iFunction=0u; iFunction<setSize; ++iFunction) pTable[iFunction * pointCount + iPoint] = pSetValues[iFunction];
+            }
+            pTable += setSize * pointCount;
+        } else {
+            for (const auto& rScalarExpression : rSet) {
+                for (unsigned iPoint=0u; iPoint<pointCount; ++iPoint) {
+                    const auto itArgument = itPointBegin + iPoint * Dim + iAxis;
+                    rScalarExpression.evaluate(itArgument, itArgument + 1, pTable++);
+                }
+            } // for rScalarExpression in rSet
+        }
+    } // for iAxis in range(Dim)
+
+    const Ptr<const Value> pValues = rTable.data();
+    const Ptr<Value> pProduct = rTable.data() + tableSize;
+    const unsigned componentCount = this->size();
+
+    // Walk the cartesian product once, and multiply the
+    // tabulated rows of all points for each ansatz function.
+    IndexBuffer indices;
+    std::fill(indices.begin(), indices.end(), 0u);
+    unsigned iComponent = 0u;
+    do {
+        const Ptr<Value> pRow = layout == BatchLayout::BasisMajor ? itOut + iComponent * pointCount : pProduct;
+        std::copy(pValues + indices[0] * pointCount, pValues + (indices[0] + 1) * pointCount, pRow);
+        for (unsigned iAxis=1u; iAxis<Dim; ++iAxis) {
+            const Ptr<const Value> pFactors = pValues + (iAxis * setSize + indices[iAxis]) * pointCount;
+            for (unsigned iPoint=0u; iPoint<pointCount; ++iPoint) pRow[iPoint] *= pFactors[iPoint];
+        }
+
+        if (layout == BatchLayout::PointMajor) {
+            for (unsigned iPoint=0u; iPoint<pointCount; ++iPoint) {
+                itOut[iPoint * componentCount + iComponent] = pRow[iPoint];
+            }
+        }
+        ++iComponent;
+    } while (OuterProduct<Dim>::next(setSize, indices.data()));
 }
 
 
@@ -171,7 +390,38 @@ AnsatzSpace<TScalarExpression,Dim>::makeDerivative() const
 template <class TScalarExpression, unsigned Dim>
 unsigned AnsatzSpace<TScalarExpression,Dim>::size() const noexcept
 {
-    return intPow(_set.size(), Dim);
+    return intPow(_pSet->size(), Dim);
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+Ref<const typename AnsatzSpace<TScalarExpression,Dim>::AnsatzSet>
+AnsatzSpace<TScalarExpression,Dim>::ansatzSet() const noexcept
+{
+    return *_pSet;
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+std::shared_ptr<const typename AnsatzSpace<TScalarExpression,Dim>::AnsatzSet>
+AnsatzSpace<TScalarExpression,Dim>::sharedAnsatzSet() const noexcept
+{
+    return _pSet;
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+unsigned AnsatzSpace<TScalarExpression,Dim>::getMinBufferSize() const noexcept
+{
+    return Dim * _pSet->size();
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+void AnsatzSpace<TScalarExpression,Dim>::setBuffer(std::span<Value> buffer)
+{
+    CIE_OUT_OF_RANGE_CHECK(this->getMinBufferSize() <= buffer.size())
+    _buffer = buffer;
 }
 
 
@@ -0,0 +1,269 @@
+#ifndef CIE_FEM_MATHS_BARYCENTRIC_LAGRANGE_BASIS_IMPL_HPP
+#define CIE_FEM_MATHS_BARYCENTRIC_LAGRANGE_BASIS_IMPL_HPP
+
+// --- FEM Includes ---
+#include "packages/maths/inc/BarycentricLagrangeBasis.hpp"
+
+// --- Utility Includes ---
+#include "packages/macros/inc/checks.hpp"
+
+// --- STL Includes ---
+#include <cmath> // abs
+
+
+namespace cie::fem::maths {
+
+
+template <class TValue>
+inline typename BarycentricLagrangeBasis<TValue>::Anchor
+BarycentricLagrangeBasis<TValue>::makeAnchor(TValue argument) const noexcept
+{
+    const unsigned nodeCount = _nodes.size();
+
+    // Find the closest node
+    Anchor anchor {0u, argument - _nodes.front(), static_cast<TValue>(0), static_cast<TValue>(0)};
+    for (unsigned iNode=1u; iNode<nodeCount; ++iNode) {
+        const TValue offset = argument - _nodes[iNode];
+        if (std::abs(offset) < std::abs(anchor.offset)) {
+            anchor.iNode = iNode;
+            anchor.offset = offset;
+        }
+    }
+
+    // The rest of the nodes are bounded away from the argument,
+    // so their terms can be summed without cancellation.
+    const TValue closestNode = _nodes[anchor.iNode];
+    TValue sum = static_cast<TValue>(0), rateSum = static_cast<TValue>(0);
+    for (unsigned iNode=0u; iNode<nodeCount; ++iNode) {
+        if (iNode == anchor.iNode) continue;
+        const TValue term = _weights[iNode] / (argument - _nodes[iNode]);
+        sum += term;
+        rateSum += term * (_nodes[iNode] - closestNode) / (argument - _nodes[iNode]);
+    }
+
+    // The denominator is a nonzero multiple of 1 / prod_{k != m} (x - x_k)
+    anchor.scale = static_cast<TValue>(1) / (_weights[anchor.iNode] + anchor.offset * sum);
+    anchor.rate = rateSum * anchor.scale;
+    return anchor;
+}
+
+
+template <class TValue>
+inline void BarycentricLagrangeBasis<TValue>::evaluate(TValue argument, Ptr<TValue> itOut) const
+{
+    if (_nodes.empty()) return;
+    const Anchor anchor = this->makeAnchor(argument);
+
+    const unsigned nodeCount = _nodes.size();
+    for (unsigned iNode=0u; iNode<nodeCount; ++iNode) {
+        itOut[iNode] = anchor.offset * _weights[iNode] * anchor.scale / (argument - _nodes[iNode]);
+    }
+    itOut[anchor.iNode] = _weights[anchor.iNode] * anchor.scale;
+}
+
+
+template <class TValue>
+inline void BarycentricLagrangeBasis<TValue>::evaluateDerivatives(TValue argument,
+                                                                  Ptr<TValue> itValues,
+                                                                  Ptr<TValue> itDerivatives) const
+{
+    if (_nodes.empty()) return;
+    const Anchor anchor = this->makeAnchor(argument);
+    const TValue closestNode = _nodes[anchor.iNode];
+
+    // l_j  = (x - x_m) * b_j
+    // l_j' = l_j * rate + b_j * (x_m - x_j) / (x - x_j)
+    // where b_j = w_j * scale / (x - x_j) stays bounded as x approaches x_m.
+    const unsigned nodeCount = _nodes.size();
+    for (unsigned iNode=0u; iNode<nodeCount; ++iNode) {
+        if (iNode == anchor.iNode) continue;
+        const TValue reciprocal = static_cast<TValue>(1) / (argument - _nodes[iNode]);
+        const TValue factor = _weights[iNode] * anchor.scale * reciprocal;
+        itValues[iNode] = anchor.offset * factor;
+        itDerivatives[iNode] = itValues[iNode] * anchor.rate + factor * (closestNode - _nodes[iNode]) * reciprocal;
+    }
+
+    itValues[anchor.iNode] = _weights[anchor.iNode] * anchor.scale;
+    itDerivatives[anchor.iNode] = itValues[anchor.iNode] * anchor.rate;
+}
+
+
+template <class TValue>
+inline TValue BarycentricLagrangeBasis<TValue>::evaluate(unsigned iFunction, TValue argument) const
+{
+    CIE_OUT_OF_RANGE_CHECK(iFunction < _nodes.size())
+    const Anchor anchor = this->makeAnchor(argument);
+    if (iFunction == anchor.iNode) return _weights[iFunction] * anchor.scale;
+    return anchor.offset * _weights[iFunction] * anchor.scale / (argument - _nodes[iFunction]);
+}
+
+
+template <class TValue>
+inline void BarycentricLagrangeBasis<TValue>::evaluateDerivatives(unsigned iFunction,
+                                                                  TValue argument,
+                                                                  Ptr<TValue> itOut) const
+{
+    CIE_OUT_OF_RANGE_CHECK(iFunction < _nodes.size())
+    const Anchor anchor = this->makeAnchor(argument);
+
+    if (iFunction == anchor.iNode) {
+        itOut[0] = _weights[iFunction] * anchor.scale;
+        itOut[1] = itOut[0] * anchor.rate;
+    } else {
+        const TValue reciprocal = static_cast<TValue>(1) / (argument - _nodes[iFunction]);
+        const TValue factor = _weights[iFunction] * anchor.scale * reciprocal;
+        itOut[0] = anchor.offset * factor;
+        itOut[1] = itOut[0] * anchor.rate + factor * (_nodes[anchor.iNode] - _nodes[iFunction]) * reciprocal;
+    }
+}
+
+
+template <class TValue>
+inline unsigned BarycentricLagrangeBasis<TValue>::size() const noexcept
+{
+    return _nodes.size();
+}
+
+
+template <class TValue>
+inline Ref<const DynamicArray<TValue>> BarycentricLagrangeBasis<TValue>::nodes() const noexcept
+{
+    return _nodes;
+}
+
+
+template <class TValue>
+inline Ref<const DynamicArray<TValue>> BarycentricLagrangeBasis<TValue>::weights() const noexcept
+{
+    return _weights;
+}
+
+
+template <class TValue>
+BarycentricLagrangePolynomialDerivative<TValue>::BarycentricLagrangePolynomialDerivative(std::shared_ptr<const BarycentricLagrangeBasis<TValue>> pBasis,
+                                                                                         unsigned iFunction) noexcept
+    : _pBasis(std::move(pBasis)),
+      _iFunction(iFunction)
+{
+}
+
+
+template <class TValue>
+inline void BarycentricLagrangePolynomialDerivative<TValue>::evaluate(ConstIterator itArgumentBegin,
+                                                                      ConstIterator,
+                                                                      Iterator itOut) const
+{
+    TValue valueAndDerivative[2];
+    _pBasis->evaluateDerivatives(_iFunction, *itArgumentBegin, valueAndDerivative);
+    *itOut = valueAndDerivative[1];
+}
+
+
+template <class TValue>
+inline unsigned BarycentricLagrangePolynomialDerivative<TValue>::size() const noexcept
+{
+    return 1u;
+}
+
+
+template <class TValue>
+inline void BarycentricLagrangePolynomial<TValue>::evaluate(ConstIterator itArgumentBegin,
+                                                            ConstIterator,
+                                                            Iterator itOut) const
+{
+    *itOut = _pBasis->evaluate(_iFunction, *itArgumentBegin);
+}
+
+
+template <class TValue>
+inline void BarycentricLagrangePolynomial<TValue>::evaluateDerivatives(TValue argument,
+                                                                       unsigned derivativeCount,
+                                                                       Iterator itOut) const
+{
+    CIE_OUT_OF_RANGE_CHECK(derivativeCount <= 1u)
+    if (derivativeCount) {
+        _pBasis->evaluateDerivatives(_iFunction, argument, itOut);
+    } else {
+        *itOut = _pBasis->evaluate(_iFunction, argument);
+    }
+}
+
+
+template <class TValue>
+inline void BarycentricLagrangePolynomial<TValue>::evaluateSet(std::span<const BarycentricLagrangePolynomial> set,
+                                                               TValue argument,
+                                                               Iterator itOut)
+{
+    if (BarycentricLagrangePolynomial::isCompleteBasis(set)) {
+        set.front()._pBasis->evaluate(argument, itOut);
+    } else {
+        for (const auto& rFunction : set) *itOut++ = rFunction._pBasis->evaluate(rFunction._iFunction, argument);
+    }
+}
+
+
+template <class TValue>
+inline void BarycentricLagrangePolynomial<TValue>::evaluateSetDerivatives(std::span<const BarycentricLagrangePolynomial> set,
+                                                                          TValue argument,
+                                                                          Iterator itValues,
+                                                                          Iterator itDerivatives)
+{
+    if (BarycentricLagrangePolynomial::isCompleteBasis(set)) {
+        set.front()._pBasis->evaluateDerivatives(argument, itValues, itDerivatives);
+    } else {
+        TValue valueAndDerivative[2];
+        for (const auto& rFunction : set) {
+            rFunction._pBasis->evaluateDerivatives(rFunction._iFunction, argument, valueAndDerivative);
+            *itValues++ = valueAndDerivative[0];
+            *itDerivatives++ = valueAndDerivative[1];
+        }
+    }
+}
+
+
+template <class TValue>
+inline unsigned BarycentricLagrangePolynomial<TValue>::size() const noexcept
+{
+    return 1u;
+}
+
+
+template <class TValue>
+inline typename BarycentricLagrangePolynomial<TValue>::Derivative
+BarycentricLagrangePolynomial<TValue>::makeDerivative() const
+{
+    return Derivative(_pBasis, _iFunction);
+}
+
+
+template <class TValue>
+inline Ref<const typename BarycentricLagrangePolynomial<TValue>::Basis>
+BarycentricLagrangePolynomial<TValue>::basis() const noexcept
+{
+    return *_pBasis;
+}
+
+
+template <class TValue>
+inline unsigned BarycentricLagrangePolynomial<TValue>::index() const noexcept
+{
+    return _iFunction;
+}
+
+
+template <class TValue>
+inline bool BarycentricLagrangePolynomial<TValue>::isCompleteBasis(std::span<const BarycentricLagrangePolynomial> set) noexcept
+{
+    if (set.empty() || !set.front()._pBasis || set.front()._pBasis->size() != set.size()) return false;
+    const Ptr<const Basis> pBasis = set.front()._pBasis.get();
+    for (unsigned iFunction=0u; iFunction<set.size(); ++iFunction) {
+        if (set[iFunction]._pBasis.get() != pBasis || set[iFunction]._iFunction != iFunction) return false;
+    }
+    return true;
+}
+
+
+} // namespace cie::fem::maths
+
+
+#endif
@@ -0,0 +1,217 @@
+#ifndef CIE_FEM_MATHS_INTEGRATED_LEGENDRE_POLYNOMIAL_IMPL_HPP
+#define CIE_FEM_MATHS_INTEGRATED_LEGENDRE_POLYNOMIAL_IMPL_HPP
+
+// --- FEM Includes ---
+#include "packages/maths/inc/IntegratedLegendrePolynomial.hpp"
+
+// --- Utility Includes ---
+#include "packages/macros/inc/checks.hpp"
+#include "packages/stl_extension/inc/StaticArray.hpp"
+
+// --- STL Includes ---
+#include <cmath> // sqrt
+
+
+namespace cie::fem::maths {
+
+
+namespace detail {
+
+
+/// @brief Legendre polynomials of degrees @a index-2, @a index-1 and @a index at a point.
+/// @details @a index must be at least 2.
+template <class TValue>
+inline StaticArray<TValue,3> legendreTriplet(unsigned index, TValue argument) noexcept
+{
+    // (k+1) L_{k+1} = (2k+1) x L_k - k L_{k-1}
+    StaticArray<TValue,3> triplet {static_cast<TValue>(0), static_cast<TValue>(1), argument};
+    for (unsigned degree=2u; degree<=index; ++degree) {
+        triplet[0] = triplet[1];
+        triplet[1] = triplet[2];
+        triplet[2] = (static_cast<TValue>(2 * degree - 1) * argument * triplet[1] - static_cast<TValue>(degree - 1) * triplet[0])
+                   / static_cast<TValue>(degree);
+    }
+    return triplet;
+}
+
+
+/// @brief Normalization factor of the @a index-th integrated Legendre polynomial.
+template <class TValue>
+inline TValue integratedLegendreScale(unsigned index) noexcept
+{
+    return static_cast<TValue>(1) / std::sqrt(static_cast<TValue>(4 * index - 2));
+}
+
+
+} // namespace detail
+
+
+template <class TValue>
+IntegratedLegendrePolynomialDerivative<TValue>::IntegratedLegendrePolynomialDerivative(unsigned index) noexcept
+    : _index(index)
+{
+}
+
+
+template <class TValue>
+inline void IntegratedLegendrePolynomialDerivative<TValue>::evaluate(ConstIterator itArgumentBegin,
+                                                                     ConstIterator,
+                                                                     Iterator itOut) const
+{
+    if (_index < 2u) {
+        *itOut = static_cast<TValue>(_index ? 0.5 : -0.5);
+    } else {
+        const auto triplet = detail::legendreTriplet(_index, *itArgumentBegin);
+        *itOut = static_cast<TValue>(2 * _index - 1) * detail::integratedLegendreScale<TValue>(_index) * triplet[1];
+    }
+}
+
+
+template <class TValue>
+inline unsigned IntegratedLegendrePolynomialDerivative<TValue>::size() const noexcept
+{
+    return 1u;
+}
+
+
+template <class TValue>
+IntegratedLegendrePolynomial<TValue>::IntegratedLegendrePolynomial(unsigned index) noexcept
+    : _index(index)
+{
+}
+
+
+template <class TValue>
+inline void IntegratedLegendrePolynomial<TValue>::evaluate(ConstIterator itArgumentBegin,
+                                                           ConstIterator,
+                                                           Iterator itOut) const
+{
+    const TValue argument = *itArgumentBegin;
+    if (_index < 2u) {
+        *itOut = static_cast<TValue>(0.5) * (_index ? static_cast<TValue>(1) + argument : static_cast<TValue>(1) - argument);
+    } else {
+        const auto triplet = detail::legendreTriplet(_index, argument);
+        *itOut = (triplet[2] - triplet[0]) * detail::integratedLegendreScale<TValue>(_index);
+    }
+}
+
+
+template <class TValue>
+inline void IntegratedLegendrePolynomial<TValue>::evaluateDerivatives(TValue argument,
+                                                                     unsigned derivativeCount,
+                                                                     Iterator itOut) const
+{
+    CIE_OUT_OF_RANGE_CHECK(derivativeCount <= 1u)
+    if (_index < 2u) {
+        itOut[0] = static_cast<TValue>(0.5) * (_index ? static_cast<TValue>(1) + argument : static_cast<TValue>(1) - argument);
+        if (derivativeCount) itOut[1] = static_cast<TValue>(_index ? 0.5 : -0.5);
+    } else {
+        const auto triplet = detail::legendreTriplet(_index, argument);
+        const TValue scale = detail::integratedLegendreScale<TValue>(_index);
+        itOut[0] = (triplet[2] - triplet[0]) * scale;
+        if (derivativeCount) itOut[1] = static_cast<TValue>(2 * _index - 1) * scale * triplet[1];
+    }
+}
+
+
+template <class TValue>
+inline void IntegratedLegendrePolynomial<TValue>::evaluateSet(std::span<const IntegratedLegendrePolynomial> set,
+                                                              TValue argument,
+                                                              Iterator itOut)
+{
+    if (!IntegratedLegendrePolynomial::isCompleteBasis(set)) {
+        for (const auto& rFunction : set) rFunction.evaluate(&argument, &argument + 1, itOut++);
+        return;
+    }
+
+    const unsigned setSize = set.size();
+    itOut[0] = static_cast<TValue>(0.5) * (static_cast<TValue>(1) - argument);
+    if (setSize < 2u) return;
+    itOut[1] = static_cast<TValue>(0.5) * (static_cast<TValue>(1) + argument);
+
+    // Walk the recurrence once, carrying L_{i-2} and L_{i-1}
+    TValue previous = static_cast<TValue>(1), current = argument;
+    for (unsigned iFunction=2u; iFunction<setSize; ++iFunction) {
+        const TValue next = (static_cast<TValue>(2 * iFunction - 1) * argument * current - static_cast<TValue>(iFunction - 1) * previous)
+                          / static_cast<TValue>(iFunction);
+        itOut[iFunction] = (next - previous) * detail::integratedLegendreScale<TValue>(iFunction);
+        previous = current;
+        current = next;
+    } // for iFunction in range(2, setSize)
+}
+
+
+template <class TValue>
+inline void IntegratedLegendrePolynomial<TValue>::evaluateSetDerivatives(std::span<const IntegratedLegendrePolynomial> set,
+                                                                         TValue argument,
+                                                                         Iterator itValues,
+                                                                         Iterator itDerivatives)
+{
+    if (!IntegratedLegendrePolynomial::isCompleteBasis(set)) {
+        StaticArray<TValue,2> valueAndDerivative;
+        for (const auto& rFunction : set) {
+            rFunction.evaluateDerivatives(argument, 1u, valueAndDerivative.data());
+            *itValues++ = valueAndDerivative[0];
+            *itDerivatives++ = valueAndDerivative[1];
+        }
+        return;
+    }
+
+    const unsigned setSize = set.size();
+    itValues[0] = static_cast<TValue>(0.5) * (static_cast<TValue>(1) - argument);
+    itDerivatives[0] = static_cast<TValue>(-0.5);
+    if (setSize < 2u) return;
+    itValues[1] = static_cast<TValue>(0.5) * (static_cast<TValue>(1) + argument);
+    itDerivatives[1] = static_cast<TValue>(0.5);
+
+    // Walk the recurrence once, carrying L_{i-2} and L_{i-1}
+    TValue previous = static_cast<TValue>(1), current = argument;
+    for (unsigned iFunction=2u; iFunction<setSize; ++iFunction) {
+        const TValue next = (static_cast<TValue>(2 * iFunction - 1) * argument * current - static_cast<TValue>(iFunction - 1) * previous)
+                          / static_cast<TValue>(iFunction);
+        const TValue scale = detail::integratedLegendreScale<TValue>(iFunction);
+        itValues[iFunction] = (next - previous) * scale;
+        itDerivatives[iFunction] = static_cast<TValue>(2 * iFunction - 1) * scale * current;
+        previous = current;
+        current = next;
+    } // for iFunction in range(2, setSize)
+}
+
+
+template <class TValue>
+inline unsigned IntegratedLegendrePolynomial<TValue>::size() const noexcept
+{
+    return 1u;
+}
+
+
+template <class TValue>
+inline typename IntegratedLegendrePolynomial<TValue>::Derivative
+IntegratedLegendrePolynomial<TValue>::makeDerivative() const
+{
+    return Derivative(_index);
+}
+
+
+template <class TValue>
+inline unsigned IntegratedLegendrePolynomial<TValue>::index() const noexcept
+{
+    return _index;
+}
+
+
+template <class TValue>
+inline bool IntegratedLegendrePolynomial<TValue>::isCompleteBasis(std::span<const IntegratedLegendrePolynomial> set) noexcept
+{
+    if (set.empty()) return false;
+    for (unsigned iFunction=0u; iFunction<set.size(); ++iFunction) {
+        if (set[iFunction]._index != iFunction) return false;
+    }
+    return true;
+}
+
+
+} // namespace cie::fem::maths
+
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef CIE_FEM_LINEAR_ISOTROPIC_STIFFNESS_ACTION_IMPL_HPP
+#define CIE_FEM_LINEAR_ISOTROPIC_STIFFNESS_ACTION_IMPL_HPP
+
+// help the language server
+#include "packages/maths/inc/LinearIsotropicStiffnessAction.hpp"
+
+// --- Utility Includes ---
+#include "packages/macros/inc/checks.hpp"
+#include "packages/stl_extension/inc/StaticArray.hpp"
+
+
+namespace cie::fem::maths {
+
+
+template <Expression TAnsatzDerivatives>
+LinearIsotropicStiffnessAction<TAnsatzDerivatives>::LinearIsotropicStiffnessAction()
+    : _modulus(0),
+      _pAnsatzDerivatives(nullptr),
+      _coefficients(),
+      _buffer()
+{
+}
+
+
+template <Expression TAnsatzDerivatives>
+LinearIsotropicStiffnessAction<TAnsatzDerivatives>::LinearIsotropicStiffnessAction(const Value modulus,
+                                                                                   Ref<const TAnsatzDerivatives> rAnsatzDerivatives,
+                                                                                   std::span<const Value> coefficients,
+                                                                                   std::span<Value> buffer)
+    : _modulus(modulus),
+      _pAnsatzDerivatives(&rAnsatzDerivatives),
+      _coefficients(),
+      _buffer()
+{
+    this->setCoefficients(coefficients);
+    this->setBuffer(buffer);
+}
+
+
+template <Expression TAnsatzDerivatives>
+void LinearIsotropicStiffnessAction<TAnsatzDerivatives>::evaluate(ConstIterator itArgumentBegin,
+                                                                  ConstIterator itArgumentEnd,
+                                                                  Iterator itOut) const
+{
+    CIE_OUT_OF_RANGE_CHECK(this->getMinBufferSize() <= _buffer.size())
+    CIE_CHECK_POINTER(_pAnsatzDerivatives)
+
+    Ref<const TAnsatzDerivatives> rAnsatzDerivatives = *_pAnsatzDerivatives;
+    const unsigned ansatzCount = rAnsatzDerivatives.size() / Dimension;
+    CIE_OUT_OF_RANGE_CHECK(_coefficients.size() == ansatzCount)
+
+    // The derivatives are stored component by component, each row holding
+    // the derivatives of all ansatz functions in one direction.
+    const Ptr<Value> pDerivatives = _buffer.data();
+    rAnsatzDerivatives.evaluate(itArgumentBegin, itArgumentEnd, pDerivatives);
+
+    // Gradient of the field described by the coefficients, scaled by the modulus
+    StaticArray<Value,Dimension> gradient;
+    for (unsigned iDimension=0u; iDimension<Dimension; ++iDimension) {
+        const Ptr<const Value> pRow = pDerivatives + iDimension * ansatzCount;
+        Value component = 0;
+        for (unsigned iAnsatz=0u; iAnsatz<ansatzCount; ++iAnsatz) {
+            component += pRow[iAnsatz] * _coefficients[iAnsatz];
+        }
+        gradient[iDimension] = _modulus * component;
+    }
+
+    // Project the gradient back onto the derivatives of the ansatz functions
+    for (unsigned iAnsatz=0u; iAnsatz<ansatzCount; ++iAnsatz) {
+        Value component = 0;
+        for (unsigned iDimension=0u; iDimension<Dimension; ++iDimension) {
+            component += pDerivatives[iDimension * ansatzCount + iAnsatz] * gradient[iDimension];
+        }
+        itOut[iAnsatz] = component;
+    }
+}
+
+
+template <Expression TAnsatzDerivatives>
+unsigned LinearIsotropicStiffnessAction<TAnsatzDerivatives>::size() const
+{
+    return _pAnsatzDerivatives->size() / Dimension;
+}
+
+
+template <Expression TAnsatzDerivatives>
+unsigned LinearIsotropicStiffnessAction<TAnsatzDerivatives>::getMinBufferSize() const noexcept
+{
+    return _pAnsatzDerivatives->size();
+}
+
+
+template <Expression TAnsatzDerivatives>
+void LinearIsotropicStiffnessAction<TAnsatzDerivatives>::setCoefficients(std::span<const Value> coefficients)
+{
+    CIE_OUT_OF_RANGE_CHECK(coefficients.size() == this->size())
+    _coefficients = coefficients;
+}
+
+
+template <Expression TAnsatzDerivatives>
+void LinearIsotropicStiffnessAction<TAnsatzDerivatives>::setBuffer(std::span<Value> buffer)
+{
+    CIE_OUT_OF_RANGE_CHECK(this->getMinBufferSize() <= buffer.size())
+    _buffer = buffer;
+}
+
+
+} // namespace cie::fem::maths
+
+
+#endif
@@ -4,6 +4,9 @@
 // --- External Includes ---
 #include <Eigen/Dense> // Eigen::Map
 
+// --- STL Includes ---
+#include <cmath> // abs
+
 // help the language server
 #include "packages/maths/inc/LinearIsotropicStiffnessIntegrand.hpp"
 
@@ -61,6 +64,32 @@ void LinearIsotropicStiffnessIntegrand<TAnsatzDerivatives>::evaluate(ConstIterat
 }
 
 
+template <Expression TAnsatzDerivatives>
+template <class TTabulation, SpatialTransformDerivative TJacobian>
+void LinearIsotropicStiffnessIntegrand<TAnsatzDerivatives>::integrate(Ref<const TTabulation> rTabulation,
+                                                                      Ref<const TJacobian> rJacobian,
+                                                                      Iterator itOut) const
+{
+    const unsigned ansatzCount = rTabulation.ansatzCount();
+
+    using EigenDenseMatrix = Eigen::Matrix<Value,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor>;
+    using EigenAdaptor = Eigen::Map<EigenDenseMatrix>;
+    using EigenConstAdaptor = Eigen::Map<const EigenDenseMatrix>;
+
+    EigenAdaptor outputAdaptor(itOut, ansatzCount, ansatzCount);
+    outputAdaptor.setZero();
+
+    for (unsigned iPoint=0u; iPoint<rTabulation.pointCount(); ++iPoint) {
+        const auto point = rTabulation.getPoint(iPoint);
+        const Value scale = rTabulation.getWeight(iPoint)
+                          * std::abs(rJacobian.evaluateDeterminant(point.data(), point.data() + point.size()))
+                          * _modulus;
+        EigenConstAdaptor derivativeAdaptor(rTabulation.getDerivatives(iPoint).data(), Dimension, ansatzCount);
+        outputAdaptor.noalias() += scale * derivativeAdaptor.transpose() * derivativeAdaptor;
+    } // for iPoint in range(pointCount)
+}
+
+
 template <Expression TAnsatzDerivatives>
 unsigned LinearIsotropicStiffnessIntegrand<TAnsatzDerivatives>::size() const
 {
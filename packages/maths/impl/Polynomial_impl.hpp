@@ -8,6 +8,9 @@
 #include "packages/maths/inc/polynomial_evaluation.hpp"
 #include "packages/macros/inc/exceptions.hpp"
 
+// --- STL Includes ---
+#include <algorithm> // fill, min
+
 
 namespace cie::fem::maths {
 
@@ -36,6 +39,34 @@ inline void Polynomial<TValue>::evaluate(ConstIterator itArgumentBegin,
 }
 
 
+template <class TValue>
+inline void Polynomial<TValue>::evaluateDerivatives(TValue argument,
+                                                    unsigned derivativeCount,
+                                                    Iterator itOut) const
+{
+    std::fill(itOut, itOut + derivativeCount + 1u, static_cast<TValue>(0));
+    if (_coefficients.empty()) return;
+
+    // Horner's scheme, with each derivative updated from the previous one's partial result.
+    // The j-th component accumulates the j-th derivative divided by j!.
+    const unsigned polynomialOrder = _coefficients.size() - 1u;
+    *itOut = _coefficients.back();
+    for (unsigned iCoefficient=polynomialOrder; 0u<iCoefficient--;) {
+        const unsigned activeCount = std::min(derivativeCount, polynomialOrder - iCoefficient);
+        for (unsigned iDerivative=activeCount; 0u<iDerivative; --iDerivative) {
+            itOut[iDerivative] = itOut[iDerivative] * argument + itOut[iDerivative - 1u];
+        }
+        *itOut = *itOut * argument + _coefficients[iCoefficient];
+    } // for iCoefficient in reversed(range(polynomialOrder))
+
+    TValue factorial = static_cast<TValue>(1);
+    for (unsigned iDerivative=2u; iDerivative<=derivativeCount; ++iDerivative) {
+        factorial *= static_cast<TValue>(iDerivative);
+        itOut[iDerivative] *= factorial;
+    }
+}
+
+
 } // namespace cie::fem::maths
 
 
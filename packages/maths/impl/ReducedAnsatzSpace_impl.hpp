@@ -0,0 +1,236 @@
+#ifndef CIE_FEM_REDUCED_ANSATZ_SPACE_IMPL_HPP
+#define CIE_FEM_REDUCED_ANSATZ_SPACE_IMPL_HPP
+
+// --- FEM Includes ---
+#include "packages/maths/inc/ReducedAnsatzSpace.hpp"
+#include "packages/maths/inc/OuterProduct.hpp"
+
+// --- Utility Includes ---
+#include "packages/macros/inc/checks.hpp"
+#include "packages/macros/inc/exceptions.hpp"
+#include "packages/maths/inc/power.hpp"
+
+// --- STL Includes ---
+#include <algorithm> // fill, all_of, find
+
+
+namespace cie::fem::maths {
+
+
+template <unsigned Dim>
+DynamicArray<StaticArray<unsigned,Dim>> makeTotalDegreeIndices(unsigned setSize, unsigned polynomialOrder)
+{
+    DynamicArray<StaticArray<unsigned,Dim>> indices;
+    if (!setSize) return indices;
+
+    StaticArray<unsigned,Dim> index;
+    std::fill(index.begin(), index.end(), 0u);
+    do {
+        unsigned degree = 0u;
+        for (const unsigned iFunction : index) degree += iFunction;
+        if (degree <= polynomialOrder) indices.push_back(index);
+    } while (OuterProduct<Dim>::next(setSize, index.data()));
+
+    return indices;
+}
+
+
+template <unsigned Dim>
+DynamicArray<StaticArray<unsigned,Dim>> makeSerendipityIndices(unsigned setSize, unsigned polynomialOrder)
+{
+    DynamicArray<StaticArray<unsigned,Dim>> indices;
+    if (!setSize) return indices;
+
+    StaticArray<unsigned,Dim> index;
+    std::fill(index.begin(), index.end(), 0u);
+    do {
+        // Vertex functions (indices 0 and 1) are linear and don't count towards the bubble degree
+        unsigned degree = 0u;
+        for (const unsigned iFunction : index) degree += 2u <= iFunction ? iFunction : 0u;
+        if (degree <= polynomialOrder) indices.push_back(index);
+    } while (OuterProduct<Dim>::next(setSize, index.data()));
+
+    return indices;
+}
+
+
+template <unsigned Dim>
+DynamicArray<StaticArray<unsigned,Dim>> makeHierarchicalIndices(unsigned setSize)
+{
+    DynamicArray<StaticArray<unsigned,Dim>> indices;
+    indices.reserve(intPow(setSize, Dim));
+
+    // Each shell holds the indices whose largest entry is iShell
+    StaticArray<unsigned,Dim> index;
+    for (unsigned iShell=0u; iShell<setSize; ++iShell) {
+        std::fill(index.begin(), index.end(), 0u);
+        do {
+            if (std::find(index.begin(), index.end(), iShell) != index.end()) indices.push_back(index);
+        } while (OuterProduct<Dim>::next(iShell + 1u, index.data()));
+    } // for iShell in range(setSize)
+
+    return indices;
+}
+
+
+template <unsigned Dim>
+DynamicArray<unsigned> makeEnrichmentMap(unsigned setSize)
+{
+    DynamicArray<unsigned> map;
+    if (!setSize) return map;
+    map.reserve(intPow(setSize, Dim));
+
+    StaticArray<unsigned,Dim> index;
+    std::fill(index.begin(), index.end(), 0u);
+    do {
+        unsigned iComponent = 0u;
+        for (unsigned iAxis=Dim; 0u<iAxis--;) iComponent = iComponent * (setSize + 1u) + index[iAxis];
+        map.push_back(iComponent);
+    } while (OuterProduct<Dim>::next(setSize, index.data()));
+
+    return map;
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+ReducedAnsatzSpaceDerivative<TScalarExpression,Dim>::ReducedAnsatzSpaceDerivative(Ref<const ReducedAnsatzSpace<TScalarExpression,Dim>> rAnsatzSpace)
+    : _derivative(rAnsatzSpace._ansatzSpace.makeDerivative()),
+      _pIndices(rAnsatzSpace._pIndices)
+{
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+inline void ReducedAnsatzSpaceDerivative<TScalarExpression,Dim>::evaluate(ConstIterator itArgumentBegin,
+                                                                          ConstIterator itArgumentEnd,
+                                                                          Iterator itOut) const
+{
+    const unsigned setSize = _derivative._pAnsatzSet->size();
+    const Ptr<const Value> pValueBuffer = _derivative.tabulate(itArgumentBegin, itArgumentEnd);
+    const Ptr<const Value> pDerivativeBuffer = pValueBuffer + Dim * setSize;
+
+    for (unsigned iDerivative=0u; iDerivative<Dim; ++iDerivative) {
+        for (const auto& rIndex : *_pIndices) {
+            Value product = static_cast<Value>(1);
+            for (unsigned iAxis=0u; iAxis<Dim; ++iAxis) {
+                product *= (iAxis == iDerivative ? pDerivativeBuffer : pValueBuffer)[iAxis * setSize + rIndex[iAxis]];
+            }
+            *itOut++ = product;
+        } // for rIndex in indices
+    } // for iDerivative in range(Dim)
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+unsigned ReducedAnsatzSpaceDerivative<TScalarExpression,Dim>::size() const noexcept
+{
+    return _pIndices ? _pIndices->size() * Dim : 0u;
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+unsigned ReducedAnsatzSpaceDerivative<TScalarExpression,Dim>::getMinBufferSize() const noexcept
+{
+    return _derivative.getMinBufferSize();
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+void ReducedAnsatzSpaceDerivative<TScalarExpression,Dim>::setBuffer(std::span<Value> buffer)
+{
+    _derivative.setBuffer(buffer);
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+ReducedAnsatzSpace<TScalarExpression,Dim>::ReducedAnsatzSpace()
+    : _ansatzSpace(),
+      _pIndices(std::make_shared<const DynamicArray<Index>>())
+{
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+ReducedAnsatzSpace<TScalarExpression,Dim>::ReducedAnsatzSpace(Ref<const AnsatzSpace<TScalarExpression,Dim>> rAnsatzSpace,
+                                                              DynamicArray<Index>&& rIndices)
+    : _ansatzSpace(rAnsatzSpace),
+      _pIndices()
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const unsigned setSize = rAnsatzSpace.ansatzSet().size();
+    for (const auto& rIndex : rIndices) {
+        CIE_CHECK(std::all_of(rIndex.begin(), rIndex.end(), [setSize](unsigned iFunction) {return iFunction < setSize;}),
+                  "Multi-index out of range for " << setSize << " scalar basis functions")
+    }
+    _pIndices = std::make_shared<const DynamicArray<Index>>(std::move(rIndices));
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+inline void ReducedAnsatzSpace<TScalarExpression,Dim>::evaluate(ConstIterator itArgumentBegin,
+                                                                ConstIterator itArgumentEnd,
+                                                                Iterator itOut) const
+{
+    const unsigned setSize = _ansatzSpace._pSet->size();
+    const Ptr<const Value> pValueBuffer = _ansatzSpace.tabulate(itArgumentBegin, itArgumentEnd);
+
+    for (const auto& rIndex : *_pIndices) {
+        Value product = static_cast<Value>(1);
+        for (unsigned iAxis=0u; iAxis<Dim; ++iAxis) product *= pValueBuffer[iAxis * setSize + rIndex[iAxis]];
+        *itOut++ = product;
+    } // for rIndex in indices
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+typename ReducedAnsatzSpace<TScalarExpression,Dim>::Derivative
+ReducedAnsatzSpace<TScalarExpression,Dim>::makeDerivative() const
+{
+    return Derivative(*this);
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+unsigned ReducedAnsatzSpace<TScalarExpression,Dim>::size() const noexcept
+{
+    return _pIndices->size();
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+Ref<const typename ReducedAnsatzSpace<TScalarExpression,Dim>::AnsatzSet>
+ReducedAnsatzSpace<TScalarExpression,Dim>::ansatzSet() const noexcept
+{
+    return _ansatzSpace.ansatzSet();
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+Ref<const DynamicArray<typename ReducedAnsatzSpace<TScalarExpression,Dim>::Index>>
+ReducedAnsatzSpace<TScalarExpression,Dim>::indices() const noexcept
+{
+    return *_pIndices;
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+unsigned ReducedAnsatzSpace<TScalarExpression,Dim>::getMinBufferSize() const noexcept
+{
+    return _ansatzSpace.getMinBufferSize();
+}
+
+
+template <class TScalarExpression, unsigned Dim>
+void ReducedAnsatzSpace<TScalarExpression,Dim>::setBuffer(std::span<Value> buffer)
+{
+    _ansatzSpace.setBuffer(buffer);
+}
+
+
+} // namespace cie::fem::maths
+
+
+#endif
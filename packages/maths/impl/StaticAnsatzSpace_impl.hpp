@@ -0,0 +1,158 @@
+#ifndef CIE_FEM_STATIC_ANSATZ_SPACE_IMPL_HPP
+#define CIE_FEM_STATIC_ANSATZ_SPACE_IMPL_HPP
+
+// --- FEM Includes ---
+#include "packages/maths/inc/StaticAnsatzSpace.hpp"
+
+// --- Utility Includes ---
+#include "packages/macros/inc/checks.hpp"
+
+// --- STL Includes ---
+#include <algorithm> // copy
+#include <iterator> // distance
+
+
+namespace cie::fem::maths {
+
+
+namespace detail {
+
+
+/// @brief Write the products of scalar factors over the cartesian product of axes [0, Axis].
+/// @details @a rAxisFactors points to the @a SetSize factors of each axis. The first axis
+///          is the innermost loop, matching the component order of @ref OuterProduct.
+template <unsigned Axis, unsigned SetSize, class TValue>
+inline void staticOuterProduct(Ref<const StaticArray<Ptr<const TValue>,Axis+1>> rAxisFactors,
+                               TValue product,
+                               Ref<Ptr<TValue>> rpOut) noexcept
+{
+    const Ptr<const TValue> pFactors = rAxisFactors[Axis];
+    if constexpr (Axis == 0) {
+        for (unsigned iFunction=0u; iFunction<SetSize; ++iFunction) *rpOut++ = product * pFactors[iFunction];
+    } else {
+        StaticArray<Ptr<const TValue>,Axis> innerFactors;
+        std::copy(rAxisFactors.begin(), rAxisFactors.begin() + Axis, innerFactors.begin());
+        for (unsigned iFunction=0u; iFunction<SetSize; ++iFunction) {
+            staticOuterProduct<Axis-1,SetSize,TValue>(innerFactors, product * pFactors[iFunction], rpOut);
+        }
+    }
+}
+
+
+} // namespace detail
+
+
+template <class TScalarExpression, unsigned SetSize, unsigned Dim>
+StaticAnsatzSpaceDerivative<TScalarExpression,SetSize,Dim>::StaticAnsatzSpaceDerivative(Ref<const StaticAnsatzSpace<TScalarExpression,SetSize,Dim>> rAnsatzSpace)
+    : _ansatzSet(rAnsatzSpace._set),
+      _derivativeSet()
+{
+    for (unsigned iFunction=0u; iFunction<SetSize; ++iFunction) {
+        _derivativeSet[iFunction] = _ansatzSet[iFunction].makeDerivative();
+    }
+}
+
+
+template <class TScalarExpression, unsigned SetSize, unsigned Dim>
+inline void StaticAnsatzSpaceDerivative<TScalarExpression,SetSize,Dim>::evaluate(ConstIterator itArgumentBegin,
+                                                                                 [[maybe_unused]] ConstIterator itArgumentEnd,
+                                                                                 Iterator itOut) const
+{
+    CIE_OUT_OF_RANGE_CHECK(std::distance(itArgumentBegin, itArgumentEnd) == Dim)
+
+    // Values and derivatives of all scalar functions, axis by axis
+    StaticArray<Value,SetSize * Dim> values, derivatives;
+    for (unsigned iAxis=0u; iAxis<Dim; ++iAxis) {
+        const auto itArgument = itArgumentBegin + iAxis;
+        for (unsigned iFunction=0u; iFunction<SetSize; ++iFunction) {
+            _ansatzSet[iFunction].evaluate(itArgument, itArgument + 1, values.data() + iAxis * SetSize + iFunction);
+            _derivativeSet[iFunction].evaluate(itArgument, itArgument + 1, derivatives.data() + iAxis * SetSize + iFunction);
+        }
+    } // for iAxis in range(Dim)
+
+    StaticArray<Ptr<const Value>,Dim> axisFactors;
+    for (unsigned iDerivative=0u; iDerivative<Dim; ++iDerivative) {
+        for (unsigned iAxis=0u; iAxis<Dim; ++iAxis) {
+            axisFactors[iAxis] = (iAxis == iDerivative ? derivatives.data() : values.data()) + iAxis * SetSize;
+        }
+        detail::staticOuterProduct<Dim-1,SetSize,Value>(axisFactors, static_cast<Value>(1), itOut);
+    } // for iDerivative in range(Dim)
+}
+
+
+template <class TScalarExpression, unsigned SetSize, unsigned Dim>
+constexpr unsigned StaticAnsatzSpaceDerivative<TScalarExpression,SetSize,Dim>::size() noexcept
+{
+    return StaticAnsatzSpace<TScalarExpression,SetSize,Dim>::size() * Dim;
+}
+
+
+template <class TScalarExpression, unsigned SetSize, unsigned Dim>
+StaticAnsatzSpace<TScalarExpression,SetSize,Dim>::StaticAnsatzSpace(Ref<const AnsatzSet> rSet)
+    : _set(rSet)
+{
+}
+
+
+template <class TScalarExpression, unsigned SetSize, unsigned Dim>
+StaticAnsatzSpace<TScalarExpression,SetSize,Dim>::StaticAnsatzSpace(Ref<const AnsatzSpace<TScalarExpression,Dim>> rAnsatzSpace)
+    : _set()
+{
+    CIE_CHECK(rAnsatzSpace.ansatzSet().size() == SetSize,
+              "Expecting " << SetSize << " scalar basis functions, but got " << rAnsatzSpace.ansatzSet().size())
+    std::copy(rAnsatzSpace.ansatzSet().begin(),
+              rAnsatzSpace.ansatzSet().end(),
+              _set.begin());
+}
+
+
+template <class TScalarExpression, unsigned SetSize, unsigned Dim>
+inline void StaticAnsatzSpace<TScalarExpression,SetSize,Dim>::evaluate(ConstIterator itArgumentBegin,
+                                                                       [[maybe_unused]] ConstIterator itArgumentEnd,
+                                                                       Iterator itOut) const
+{
+    CIE_OUT_OF_RANGE_CHECK(std::distance(itArgumentBegin, itArgumentEnd) == Dim)
+
+    StaticArray<Value,SetSize * Dim> values;
+    StaticArray<Ptr<const Value>,Dim> axisFactors;
+    for (unsigned iAxis=0u; iAxis<Dim; ++iAxis) {
+        const auto itArgument = itArgumentBegin + iAxis;
+        for (unsigned iFunction=0u; iFunction<SetSize; ++iFunction) {
+            _set[iFunction].evaluate(itArgument, itArgument + 1, values.data() + iAxis * SetSize + iFunction);
+        }
+        axisFactors[iAxis] = values.data() + iAxis * SetSize;
+    } // for iAxis in range(Dim)
+
+    detail::staticOuterProduct<Dim-1,SetSize,Value>(axisFactors, static_cast<Value>(1), itOut);
+}
+
+
+template <class TScalarExpression, unsigned SetSize, unsigned Dim>
+typename StaticAnsatzSpace<TScalarExpression,SetSize,Dim>::Derivative
+StaticAnsatzSpace<TScalarExpression,SetSize,Dim>::makeDerivative() const
+{
+    return Derivative(*this);
+}
+
+
+template <class TScalarExpression, unsigned SetSize, unsigned Dim>
+constexpr unsigned StaticAnsatzSpace<TScalarExpression,SetSize,Dim>::size() noexcept
+{
+    unsigned size = 1u;
+    for (unsigned iAxis=0u; iAxis<Dim; ++iAxis) size *= SetSize;
+    return size;
+}
+
+
+template <class TScalarExpression, unsigned SetSize, unsigned Dim>
+Ref<const typename StaticAnsatzSpace<TScalarExpression,SetSize,Dim>::AnsatzSet>
+StaticAnsatzSpace<TScalarExpression,SetSize,Dim>::ansatzSet() const noexcept
+{
+    return _set;
+}
+
+
+} // namespace cie::fem::maths
+
+
+#endif
@@ -9,6 +9,10 @@
 #include "packages/stl_extension/inc/StaticArray.hpp"
 #include "packages/concurrency/inc/ThreadLocal.hpp"
 
+// --- STL Includes ---
+#include <memory> // shared_ptr
+#include <span> // span
+
 
 namespace cie::fem::maths {
 
@@ -17,6 +21,14 @@ template <class TScalarExpression, unsigned Dim>
 class AnsatzSpace;
 
 
+template <class TScalarExpression, unsigned Dim>
+class ReducedAnsatzSpace;
+
+
+template <class TScalarExpression, unsigned Dim>
+class ReducedAnsatzSpaceDerivative;
+
+
 
 template <class TScalarExpression, unsigned Dim>
 class AnsatzSpaceDerivative : public ExpressionTraits<typename TScalarExpression::Value>
@@ -37,33 +49,91 @@ public:
                   ConstIterator itArgumentEnd,
                   Iterator itOut) const;
 
+    /// @brief Evaluate the derivatives at a set of points.
+    /// @param itPointBegin Coordinates of the points, stored contiguously point by point.
+    /// @param pointCount Number of points.
+    /// @param itOut Output with @ref size components per point, arranged according to @a layout.
+    /// @param layout Memory layout of the output (see @ref BatchLayout).
+    /// @details Scalar basis functions and their derivatives are tabulated once per axis for all
+    ///          points, and the cartesian product is walked once for the whole batch.
+    void evaluateBatch(ConstIterator itPointBegin,
+                       unsigned pointCount,
+                       Iterator itOut,
+                       BatchLayout layout = BatchLayout::BasisMajor) const;
+
     unsigned size() const noexcept;
 
+    /// @brief Minimum size of the buffer required by @ref evaluate.
+    unsigned getMinBufferSize() const noexcept;
+
+    /// @brief Provide scratch space for @ref evaluate, of at least @ref getMinBufferSize components.
+    /// @details Without a buffer, @ref evaluate falls back to storage private to each thread.
+    ///          Copies inherit the buffer, so each thread should set its own.
+    void setBuffer(std::span<Value> buffer);
+
 private:
     friend class AnsatzSpace<TScalarExpression,Dim>;
 
+    friend class ReducedAnsatzSpaceDerivative<TScalarExpression,Dim>;
+
     AnsatzSpaceDerivative(Ref<const AnsatzSpace<TScalarExpression,Dim>> rAnsatzSpace);
 
-private:
-    DynamicArray<TScalarExpression> _ansatzSet;
+    /// @brief Evaluate all scalar functions and their derivatives at each coordinate of a point.
+    /// @return Scratch space holding the values of all scalar functions axis by axis,
+    ///         followed by their derivatives in the same order.
+    Ptr<const Value> tabulate(ConstIterator itArgumentBegin,
+                              ConstIterator itArgumentEnd) const;
 
-    DynamicArray<typename TScalarExpression::Derivative> _derivativeSet;
+    /// @brief Evaluate a scalar basis function and its derivative at a single coordinate.
+    void evaluateScalar(unsigned iFunction,
+                        ConstIterator itArgument,
+                        Ref<Value> rValue,
+                        Ref<Value> rDerivative) const;
+
+private:
+    /// @brief Whether scalar functions evaluate their value and derivatives in a single pass
+    ///        (see @ref Polynomial::evaluateDerivatives).
+    static constexpr bool HasFusedDerivatives = requires (Ref<const TScalarExpression> rScalarExpression, Ptr<Value> pOut)
+    {
+        rScalarExpression.evaluateDerivatives(Value(), 1u, pOut);
+    };
+
+    /// @brief Whether the whole set of scalar functions evaluates its values and derivatives at once
+    ///        (see @ref BarycentricLagrangePolynomial::evaluateSetDerivatives).
+    static constexpr bool HasSetEvaluation = requires (Iterator itOut)
+    {
+        TScalarExpression::evaluateSetDerivatives(std::span<const TScalarExpression>(), Value(), itOut, itOut);
+    };
 
     using IndexBuffer = StaticArray<unsigned,Dim>;
 
     using ValueBuffer = DynamicArray<Value>;
 
-    /// @brief A threadsafe container for eliminating allocations from @ref AnsatzSpaceDerivative::evaluate.
-    mutable mp::ThreadLocal<
-        IndexBuffer, // <== indices for the cartesian product
-        ValueBuffer, // <== buffer for ansatz function values at the cartesian grid points
-        ValueBuffer  // <== buffer for the derivatives at the cartesian grid points
-    > _buffer;
+    using ThreadBuffers = mp::ThreadLocal<
+        ValueBuffer, // <== scalar values and derivatives for evaluate
+        ValueBuffer  // <== scalar values and derivatives at batches of points
+    >;
+
+    /// @brief Scalar basis functions, shared with the ansatz space and its copies.
+    std::shared_ptr<const DynamicArray<TScalarExpression>> _pAnsatzSet;
+
+    /// @brief Derivatives of the scalar basis functions, shared between copies.
+    /// @details Left empty if @ref HasFusedDerivatives.
+    std::shared_ptr<const DynamicArray<typename TScalarExpression::Derivative>> _pDerivativeSet;
+
+    /// @brief Optional caller-provided scratch space for @ref evaluate.
+    std::span<Value> _buffer;
+
+    /// @brief Fallback scratch space private to each thread, shared between copies.
+    std::shared_ptr<ThreadBuffers> _pThreadBuffers;
 }; // class AnsatzSpaceDerivative
 
 
 
 /** @brief A set of multidimensional functions constructed from the cartesian product of a set of scalar basis functions.
+ *  @details Satisfies @ref BufferedExpression. Scratch space for @ref evaluate can be provided through
+ *           @ref setBuffer, in which case no thread-local storage is consulted. The scalar basis is
+ *           shared between copies and derivatives, so copying an ansatz space does not allocate.
  */
 template <class TScalarExpression, unsigned Dim>
 class AnsatzSpace : public ExpressionTraits<typename TScalarExpression::Value>
@@ -95,24 +165,80 @@ public:
                   ConstIterator itArgumentEnd,
                   Iterator itOut) const;
 
+    /// @brief Evaluate the ansatz functions at a set of points.
+    /// @param itPointBegin Coordinates of the points, stored contiguously point by point.
+    /// @param pointCount Number of points.
+    /// @param itOut Output with @ref size components per point, arranged according to @a layout.
+    /// @param layout Memory layout of the output (see @ref BatchLayout).
+    /// @details Scalar basis functions are tabulated once per axis for all points, and the
+    ///          cartesian product is walked once for the whole batch.
+    void evaluateBatch(ConstIterator itPointBegin,
+                       unsigned pointCount,
+                       Iterator itOut,
+                       BatchLayout layout = BatchLayout::BasisMajor) const;
+
     Derivative makeDerivative() const;
 
     unsigned size() const noexcept;
 
-private:
-    AnsatzSet _set;
+    /// @brief Scalar basis functions the ansatz space is the cartesian product of.
+    Ref<const AnsatzSet> ansatzSet() const noexcept;
+
+    /// @brief Shared ownership of the scalar basis functions.
+    /// @details Identifies the ansatz space and all of its copies, and outlives them if held onto.
+    std::shared_ptr<const AnsatzSet> sharedAnsatzSet() const noexcept;
+
+    /// @brief Minimum size of the buffer required by @ref evaluate.
+    unsigned getMinBufferSize() const noexcept;
 
+    /// @brief Provide scratch space for @ref evaluate, of at least @ref getMinBufferSize components.
+    /// @details Without a buffer, @ref evaluate falls back to storage private to each thread.
+    ///          Copies inherit the buffer, so each thread should set its own.
+    void setBuffer(std::span<Value> buffer);
+
+private:
     using IndexBuffer = StaticArray<unsigned,Dim>;
 
     using ValueBuffer = DynamicArray<Value>;
 
+    using ThreadBuffers = mp::ThreadLocal<
+        ValueBuffer, // <== scalar values for evaluate
+        ValueBuffer  // <== scalar values at batches of points
+    >;
+
     friend class AnsatzSpaceDerivative<TScalarExpression,Dim>;
 
-    /// @brief A threadsafe container for eliminating allocations from @ref AnsatzSpace::evaluate.
-    mutable mp::ThreadLocal<
-        IndexBuffer,
-        ValueBuffer
-    > _buffer;
+    friend class ReducedAnsatzSpace<TScalarExpression,Dim>;
+
+    /// @brief Evaluate all scalar functions at each coordinate of a point.
+    /// @return Scratch space holding the values of all scalar functions, axis by axis.
+    Ptr<const Value> tabulate(ConstIterator itArgumentBegin,
+                              ConstIterator itArgumentEnd) const;
+
+    /// @brief Whether scalar functions can be evaluated at many arguments at once
+    ///        (see @ref Polynomial::evaluateBatch).
+    static constexpr bool HasBatchEvaluation = requires (Ref<const TScalarExpression> rScalarExpression,
+                                                         ConstIterator itArguments,
+                                                         Iterator itOut)
+    {
+        rScalarExpression.evaluateBatch(itArguments, 1u, itOut);
+    };
+
+    /// @brief Whether the whole set of scalar functions can be evaluated at once
+    ///        (see @ref BarycentricLagrangePolynomial::evaluateSet).
+    static constexpr bool HasSetEvaluation = requires (Iterator itOut)
+    {
+        TScalarExpression::evaluateSet(std::span<const TScalarExpression>(), Value(), itOut);
+    };
+
+    /// @brief Scalar basis functions, shared between copies and derivatives.
+    std::shared_ptr<const AnsatzSet> _pSet;
+
+    /// @brief Optional caller-provided scratch space for @ref evaluate.
+    std::span<Value> _buffer;
+
+    /// @brief Fallback scratch space private to each thread, shared between copies.
+    std::shared_ptr<ThreadBuffers> _pThreadBuffers;
 }; // class AnsatzSpace
 
 
@@ -0,0 +1,229 @@
+#ifndef CIE_FEM_MATHS_BARYCENTRIC_LAGRANGE_BASIS_HPP
+#define CIE_FEM_MATHS_BARYCENTRIC_LAGRANGE_BASIS_HPP
+
+// --- FEM Includes ---
+#include "packages/maths/inc/Expression.hpp"
+
+// --- Utility Includes ---
+#include "packages/types/inc/types.hpp"
+#include "packages/stl_extension/inc/DynamicArray.hpp"
+
+// --- STL Includes ---
+#include <memory> // shared_ptr
+#include <span> // span
+
+
+namespace cie::fem::maths {
+
+
+/** @brief Complete set of Lagrange polynomials on a set of nodes, in barycentric form.
+ *  @details Unlike @ref LagrangePolynomial, the polynomials are never expanded into monomial
+ *           coefficients. Only the nodes @f$ x_k @f$ and their barycentric weights
+ *           @f$ w_k = 1 / \prod_{l \neq k} (x_k - x_l) @f$ are stored, which costs
+ *           @f$ \mathcal{O}(n^2) @f$ to construct for @f$ n @f$ nodes. Evaluating all
+ *           @f$ n @f$ polynomials (and their derivatives) at a point then costs @f$ \mathcal{O}(n) @f$.
+ *
+ *           Evaluation uses the second barycentric formula, rearranged around the node closest
+ *           to the argument, so that no branch is needed at the nodes themselves and no
+ *           cancellation occurs in their vicinity. This keeps the basis accurate at orders
+ *           where the monomial representation is hopelessly ill-conditioned.
+ */
+template <class TValue>
+class BarycentricLagrangeBasis
+{
+public:
+    using Value = TValue;
+
+public:
+    BarycentricLagrangeBasis() noexcept = default;
+
+    /** @brief Construct the Lagrange basis on the provided nodes.
+     *  @param pNodeBegin: pointer to the first node.
+     *  @param pNodeEnd: pointer past the last node.
+     *  @note Nodes must be distinct.
+     */
+    BarycentricLagrangeBasis(Ptr<const TValue> pNodeBegin,
+                             Ptr<const TValue> pNodeEnd);
+
+    /// @brief Evaluate all basis functions at a point.
+    /// @param argument Point to evaluate the basis at.
+    /// @param itOut Output for @ref size values, in the order of the nodes.
+    void evaluate(TValue argument, Ptr<TValue> itOut) const;
+
+    /// @brief Evaluate all basis functions and their first derivatives at a point.
+    /// @param argument Point to evaluate the basis at.
+    /// @param itValues Output for @ref size values, in the order of the nodes.
+    /// @param itDerivatives Output for @ref size derivatives, in the order of the nodes.
+    void evaluateDerivatives(TValue argument,
+                             Ptr<TValue> itValues,
+                             Ptr<TValue> itDerivatives) const;
+
+    /// @brief Evaluate a single basis function at a point.
+    TValue evaluate(unsigned iFunction, TValue argument) const;
+
+    /// @brief Evaluate a single basis function and its first derivative at a point.
+    /// @param itOut Output for the value followed by the derivative.
+    void evaluateDerivatives(unsigned iFunction,
+                             TValue argument,
+                             Ptr<TValue> itOut) const;
+
+    /// @brief Number of basis functions (equal to the number of nodes).
+    unsigned size() const noexcept;
+
+    Ref<const DynamicArray<TValue>> nodes() const noexcept;
+
+    /// @brief Barycentric weights, normalized to a maximum magnitude of 1.
+    Ref<const DynamicArray<TValue>> weights() const noexcept;
+
+private:
+    /// @brief Quantities shared by all basis functions at a given point.
+    struct Anchor
+    {
+        /// @brief Index of the node closest to the point.
+        unsigned iNode;
+
+        /// @brief Distance of the point from the closest node.
+        TValue offset;
+
+        /// @brief Reciprocal of @f$ w_m + (x - x_m) \sum_{k \neq m} w_k / (x - x_k) @f$.
+        TValue scale;
+
+        /// @brief Logarithmic derivative of the closest node's basis function.
+        TValue rate;
+    }; // struct Anchor
+
+    Anchor makeAnchor(TValue argument) const noexcept;
+
+private:
+    DynamicArray<TValue> _nodes;
+
+    DynamicArray<TValue> _weights;
+}; // class BarycentricLagrangeBasis
+
+
+
+template <class TValue>
+class BarycentricLagrangePolynomial;
+
+
+/// @brief Derivative of a @ref BarycentricLagrangePolynomial.
+template <class TValue>
+class BarycentricLagrangePolynomialDerivative : public ExpressionTraits<TValue>
+{
+public:
+    using typename ExpressionTraits<TValue>::Iterator;
+
+    using typename ExpressionTraits<TValue>::ConstIterator;
+
+public:
+    BarycentricLagrangePolynomialDerivative() noexcept = default;
+
+    void evaluate(ConstIterator itArgumentBegin,
+                  ConstIterator itArgumentEnd,
+                  Iterator itOut) const;
+
+    unsigned size() const noexcept;
+
+private:
+    friend class BarycentricLagrangePolynomial<TValue>;
+
+    BarycentricLagrangePolynomialDerivative(std::shared_ptr<const BarycentricLagrangeBasis<TValue>> pBasis,
+                                            unsigned iFunction) noexcept;
+
+private:
+    std::shared_ptr<const BarycentricLagrangeBasis<TValue>> _pBasis;
+
+    unsigned _iFunction;
+}; // class BarycentricLagrangePolynomialDerivative
+
+
+
+/** @brief Scalar @ref Expression representing one function of a @ref BarycentricLagrangeBasis.
+ *  @details Functions of the same basis share it, so a complete set constructed by @ref makeSet
+ *           stores its nodes and weights only once. Evaluating a single function costs
+ *           @f$ \mathcal{O}(n) @f$, but @ref evaluateSet evaluates a complete set in the same time,
+ *           which @ref AnsatzSpace takes advantage of.
+ */
+template <class TValue>
+class BarycentricLagrangePolynomial : public ExpressionTraits<TValue>
+{
+public:
+    using typename ExpressionTraits<TValue>::Iterator;
+
+    using typename ExpressionTraits<TValue>::ConstIterator;
+
+    using Basis = BarycentricLagrangeBasis<TValue>;
+
+    using Derivative = BarycentricLagrangePolynomialDerivative<TValue>;
+
+public:
+    BarycentricLagrangePolynomial() noexcept = default;
+
+    /// @brief Construct the @a iFunction-th function of a shared basis.
+    BarycentricLagrangePolynomial(std::shared_ptr<const Basis> pBasis,
+                                  unsigned iFunction);
+
+    /** @brief Construct the complete set of Lagrange polynomials on the provided nodes.
+     *  @param pNodeBegin: pointer to the first node.
+     *  @param pNodeEnd: pointer past the last node.
+     *  @return One polynomial per node, in the order of the nodes, all sharing the same basis.
+     */
+    static DynamicArray<BarycentricLagrangePolynomial> makeSet(Ptr<const TValue> pNodeBegin,
+                                                               Ptr<const TValue> pNodeEnd);
+
+    void evaluate(ConstIterator itArgumentBegin,
+                  ConstIterator itArgumentEnd,
+                  Iterator itOut) const;
+
+    /// @brief Evaluate the polynomial and its first derivative.
+    /// @param argument Point to evaluate the polynomial at.
+    /// @param derivativeCount Number of derivatives to compute; at most 1.
+    /// @param itOut Output for the value followed by @a derivativeCount derivatives.
+    /// @see Polynomial::evaluateDerivatives
+    void evaluateDerivatives(TValue argument,
+                             unsigned derivativeCount,
+                             Iterator itOut) const;
+
+    /// @brief Evaluate a set of polynomials at a point.
+    /// @details If @a set is a complete basis in the order of its nodes (see @ref makeSet),
+    ///          all functions are evaluated at once in @f$ \mathcal{O}(n) @f$. Otherwise,
+    ///          each function is evaluated separately.
+    /// @param itOut Output for one value per function in @a set.
+    static void evaluateSet(std::span<const BarycentricLagrangePolynomial> set,
+                            TValue argument,
+                            Iterator itOut);
+
+    /// @brief Evaluate a set of polynomials and their first derivatives at a point.
+    /// @details Complete sets are evaluated at once, as in @ref evaluateSet.
+    /// @param itValues Output for one value per function in @a set.
+    /// @param itDerivatives Output for one derivative per function in @a set.
+    static void evaluateSetDerivatives(std::span<const BarycentricLagrangePolynomial> set,
+                                       TValue argument,
+                                       Iterator itValues,
+                                       Iterator itDerivatives);
+
+    unsigned size() const noexcept;
+
+    Derivative makeDerivative() const;
+
+    Ref<const Basis> basis() const noexcept;
+
+    /// @brief Index of the node the polynomial evaluates to 1 at.
+    unsigned index() const noexcept;
+
+private:
+    /// @brief Check whether a set is the complete basis of its first function, in order.
+    static bool isCompleteBasis(std::span<const BarycentricLagrangePolynomial> set) noexcept;
+
+private:
+    std::shared_ptr<const Basis> _pBasis;
+
+    unsigned _iFunction;
+}; // class BarycentricLagrangePolynomial
+
+
+} // namespace cie::fem::maths
+
+#include "packages/maths/impl/BarycentricLagrangeBasis_impl.hpp"
+
+#endif
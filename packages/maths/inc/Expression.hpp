@@ -191,6 +191,16 @@ concept BufferedExpression
 }; // concept BufferedExpression
 
 
+/// @brief Memory layout of the output of batched evaluations over a set of points.
+enum class BatchLayout
+{
+    /// @brief Values of each component at all points are contiguous: @a out[iComponent * pointCount + iPoint].
+    BasisMajor,
+    /// @brief Values of all components at each point are contiguous: @a out[iPoint * size + iComponent].
+    PointMajor
+}; // enum class BatchLayout
+
+
 /// @brief Trait class exposing type aliases required by @ref Expression.
 /// @ingroup fem
 template <class TValue>
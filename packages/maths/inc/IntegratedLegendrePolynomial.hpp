@@ -0,0 +1,142 @@
+#ifndef CIE_FEM_MATHS_INTEGRATED_LEGENDRE_POLYNOMIAL_HPP
+#define CIE_FEM_MATHS_INTEGRATED_LEGENDRE_POLYNOMIAL_HPP
+
+// --- FEM Includes ---
+#include "packages/maths/inc/Expression.hpp"
+
+// --- Utility Includes ---
+#include "packages/types/inc/types.hpp"
+#include "packages/stl_extension/inc/DynamicArray.hpp"
+
+// --- STL Includes ---
+#include <span> // span
+
+
+namespace cie::fem::maths {
+
+
+/// @brief Derivative of an @ref IntegratedLegendrePolynomial.
+/// @details Up to a constant factor, the derivative of the @a i-th integrated
+///          Legendre polynomial is the Legendre polynomial of degree @a i-1.
+template <class TValue>
+class IntegratedLegendrePolynomialDerivative : public ExpressionTraits<TValue>
+{
+public:
+    using typename ExpressionTraits<TValue>::Iterator;
+
+    using typename ExpressionTraits<TValue>::ConstIterator;
+
+public:
+    IntegratedLegendrePolynomialDerivative() noexcept = default;
+
+    explicit IntegratedLegendrePolynomialDerivative(unsigned index) noexcept;
+
+    void evaluate(ConstIterator itArgumentBegin,
+                  ConstIterator itArgumentEnd,
+                  Iterator itOut) const;
+
+    unsigned size() const noexcept;
+
+private:
+    unsigned _index;
+}; // class IntegratedLegendrePolynomialDerivative
+
+
+
+/** @brief Scalar @ref Expression representing a member of the hierarchical integrated-Legendre basis on [-1, 1].
+ *  @details The basis consists of the two linear vertex functions, followed by bubbles that vanish at both ends:
+ *           @f[
+ *              \begin{align}
+ *                  \mathcal{N}_0(x) &= \frac{1 - x}{2}  \\
+ *                  \mathcal{N}_1(x) &= \frac{1 + x}{2}  \\
+ *                  \mathcal{N}_i(x) &= \frac{L_i(x) - L_{i-2}(x)}{\sqrt{2(2i-1)}}
+ *                                   = \sqrt{\frac{2i-1}{2}} \int_{-1}^{x} L_{i-1}(t) dt, \qquad 2 \leq i
+ *              \end{align}
+ *           @f]
+ *           where @f$ L_i @f$ is the Legendre polynomial of degree @a i. The derivatives of the bubbles are
+ *           orthonormal, so the 1D stiffness matrix is diagonal in the bubbles and ansatz spaces built
+ *           on this basis stay well conditioned as the order grows, unlike monomials or equidistant
+ *           Lagrange polynomials.
+ *
+ *           The basis is hierarchical: the set of order @a p+1 is the set of order @a p with one
+ *           bubble appended, so tabulations and 1D element matrices computed for order @a p remain
+ *           valid as the leading block of those for order @a p+1. In more dimensions, the default
+ *           component order of @ref AnsatzSpace interleaves the new functions with the old ones;
+ *           use @ref makeEnrichmentMap to locate the old components, or a @ref ReducedAnsatzSpace
+ *           on @ref makeHierarchicalIndices to keep them in the leading block.
+ *
+ *           Functions are evaluated with the three-term Legendre recurrence rather than with
+ *           monomial coefficients, which would suffer from cancellation at high orders.
+ */
+template <class TValue>
+class IntegratedLegendrePolynomial : public ExpressionTraits<TValue>
+{
+public:
+    using typename ExpressionTraits<TValue>::Iterator;
+
+    using typename ExpressionTraits<TValue>::ConstIterator;
+
+    using Derivative = IntegratedLegendrePolynomialDerivative<TValue>;
+
+public:
+    IntegratedLegendrePolynomial() noexcept = default;
+
+    /// @brief Construct the @a index-th member of the basis.
+    explicit IntegratedLegendrePolynomial(unsigned index) noexcept;
+
+    /// @brief Construct the basis of the provided polynomial order.
+    /// @return @a polynomialOrder + 1 functions, in the order of their indices.
+    static DynamicArray<IntegratedLegendrePolynomial> makeSet(unsigned polynomialOrder);
+
+    void evaluate(ConstIterator itArgumentBegin,
+                  ConstIterator itArgumentEnd,
+                  Iterator itOut) const;
+
+    /// @brief Evaluate the polynomial and its first derivative in a single recurrence.
+    /// @param argument Point to evaluate the polynomial at.
+    /// @param derivativeCount Number of derivatives to compute; at most 1.
+    /// @param itOut Output for the value followed by @a derivativeCount derivatives.
+    /// @see Polynomial::evaluateDerivatives
+    void evaluateDerivatives(TValue argument,
+                             unsigned derivativeCount,
+                             Iterator itOut) const;
+
+    /// @brief Evaluate a set of basis functions at a point.
+    /// @details If @a set is a complete basis in the order of its indices (see @ref makeSet),
+    ///          a single recurrence evaluates all functions. Otherwise, each function is
+    ///          evaluated separately.
+    /// @param itOut Output for one value per function in @a set.
+    static void evaluateSet(std::span<const IntegratedLegendrePolynomial> set,
+                            TValue argument,
+                            Iterator itOut);
+
+    /// @brief Evaluate a set of basis functions and their first derivatives at a point.
+    /// @details Complete sets are evaluated in a single recurrence, as in @ref evaluateSet.
+    /// @param itValues Output for one value per function in @a set.
+    /// @param itDerivatives Output for one derivative per function in @a set.
+    static void evaluateSetDerivatives(std::span<const IntegratedLegendrePolynomial> set,
+                                       TValue argument,
+                                       Iterator itValues,
+                                       Iterator itDerivatives);
+
+    unsigned size() const noexcept;
+
+    Derivative makeDerivative() const;
+
+    /// @brief Position of the function within the hierarchical basis.
+    unsigned index() const noexcept;
+
+private:
+    /// @brief Check whether a set consists of the first @a set.size() functions of the basis, in order.
+    static bool isCompleteBasis(std::span<const IntegratedLegendrePolynomial> set) noexcept;
+
+private:
+    unsigned _index;
+}; // class IntegratedLegendrePolynomial
+
+
+} // namespace cie::fem::maths
+
+#include "packages/maths/impl/IntegratedLegendrePolynomial_impl.hpp"
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef CIE_FEM_LINEAR_ISOTROPIC_STIFFNESS_ACTION_HPP
+#define CIE_FEM_LINEAR_ISOTROPIC_STIFFNESS_ACTION_HPP
+
+// --- FEM Includes ---
+#include "packages/maths/inc/Expression.hpp"
+
+// --- STL Includes ---
+#include <span> // span
+
+
+namespace cie::fem::maths {
+
+
+/// @brief Product of the @ref LinearIsotropicStiffnessIntegrand "linear isotropic stiffness integrand" with a vector of local coefficients.
+/// @details Computes @f$ E \nabla N^T (\nabla N u) @f$ without forming the local stiffness matrix,
+///          which reduces the work at each point from quadratic to linear in the number of ansatz
+///          functions. Integrating this expression yields the product of the local stiffness
+///          matrix with the coefficients, which is the building block of matrix-free operators.
+template <Expression TAnsatzDerivatives>
+class LinearIsotropicStiffnessAction : public ExpressionTraits<typename TAnsatzDerivatives::Value>
+{
+public:
+    static constexpr unsigned Dimension = TAnsatzDerivatives::Dimension;
+
+    using typename ExpressionTraits<typename TAnsatzDerivatives::Value>::Value;
+
+    using typename ExpressionTraits<Value>::ConstIterator;
+
+    using typename ExpressionTraits<Value>::Iterator;
+
+public:
+    LinearIsotropicStiffnessAction();
+
+    /// @param modulus Isotropic stiffness modulus.
+    /// @param rAnsatzDerivatives Derivatives of the ansatz space.
+    /// @param coefficients Local coefficients of the ansatz functions to multiply with.
+    /// @param buffer Scratch space of at least @ref getMinBufferSize components.
+    LinearIsotropicStiffnessAction(const Value modulus,
+                                   Ref<const TAnsatzDerivatives> rAnsatzDerivatives,
+                                   std::span<const Value> coefficients,
+                                   std::span<Value> buffer);
+
+    void evaluate(ConstIterator itArgumentBegin,
+                  ConstIterator itArgumentEnd,
+                  Iterator itOut) const;
+
+    unsigned size() const;
+
+    unsigned getMinBufferSize() const noexcept;
+
+    void setCoefficients(std::span<const Value> coefficients);
+
+    void setBuffer(std::span<Value> buffer);
+
+private:
+    Value _modulus;
+
+    Ptr<const TAnsatzDerivatives> _pAnsatzDerivatives;
+
+    std::span<const Value> _coefficients;
+
+    std::span<Value> _buffer;
+}; // class LinearIsotropicStiffnessAction
+
+
+} // namespace cie::fem::maths
+
+#include "packages/maths/impl/LinearIsotropicStiffnessAction_impl.hpp"
+
+#endif
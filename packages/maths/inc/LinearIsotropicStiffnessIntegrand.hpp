@@ -38,6 +38,18 @@ public:
                   ConstIterator itArgumentEnd,
                   Iterator itOut) const;
 
+    /// @brief Integrate over a cell using ansatz derivatives tabulated at the nodes of a quadrature.
+    /// @param rTabulation Tabulated ansatz derivatives (see @ref AnsatzTabulation).
+    /// @param rJacobian Derivative of the cell's spatial transform.
+    /// @param itOut Output for the row-major local stiffness matrix.
+    /// @details Equivalent to integrating the @ref TransformedIntegrand "transformed" integrand with the
+    ///          tabulated quadrature, but the work per cell reduces to evaluating the Jacobian's determinant
+    ///          at each node and a rank-@a Dimension update of the local matrix. No buffer is required.
+    template <class TTabulation, SpatialTransformDerivative TJacobian>
+    void integrate(Ref<const TTabulation> rTabulation,
+                   Ref<const TJacobian> rJacobian,
+                   Iterator itOut) const;
+
     unsigned size() const;
 
     unsigned getMinBufferSize() const noexcept;
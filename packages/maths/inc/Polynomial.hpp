@@ -53,6 +53,28 @@ public:
                   ConstIterator itArgumentEnd,
                   Iterator itResultBegin) const;
 
+    /// @brief Evaluate the polynomial at a set of arguments.
+    /// @param itArgumentBegin First of @a argumentCount contiguous arguments.
+    /// @param argumentCount Number of arguments.
+    /// @param itOut Output for @a argumentCount values.
+    /// @details Runs Horner's scheme on all arguments simultaneously, with the arguments
+    ///          in SIMD lanes. On x86-64 with GCC or Clang, AVX-512 and AVX2 versions are
+    ///          compiled as well, and the best one supported by the CPU is picked at runtime.
+    void evaluateBatch(ConstIterator itArgumentBegin,
+                       unsigned argumentCount,
+                       Iterator itOut) const;
+
+    /// @brief Evaluate the polynomial and its first derivatives in a single Horner pass.
+    /// @param argument Point to evaluate the polynomial at.
+    /// @param derivativeCount Number of derivatives to compute.
+    /// @param itOut Output for @a derivativeCount + 1 components: the value followed by
+    ///              the derivatives in increasing order.
+    /// @details Walks the coefficients once, instead of once for the polynomial and
+    ///          once for each of its @ref makeDerivative "derivatives".
+    void evaluateDerivatives(TValue argument,
+                             unsigned derivativeCount,
+                             Iterator itOut) const;
+
     /// @brief Get the number of scalar components returned by @ref evaluate.
     unsigned size() const noexcept;
 
@@ -0,0 +1,197 @@
+#ifndef CIE_FEM_REDUCED_ANSATZ_SPACE_HPP
+#define CIE_FEM_REDUCED_ANSATZ_SPACE_HPP
+
+// --- FEM Includes ---
+#include "packages/maths/inc/Expression.hpp"
+#include "packages/maths/inc/AnsatzSpace.hpp"
+
+// --- Utility Includes ---
+#include "packages/stl_extension/inc/DynamicArray.hpp"
+#include "packages/stl_extension/inc/StaticArray.hpp"
+
+// --- STL Includes ---
+#include <memory> // shared_ptr
+#include <span> // span
+
+
+namespace cie::fem::maths {
+
+
+/** @brief Collect the multi-indices of a total degree set.
+ *  @details Multi-indices @f$ (i_0, \dots, i_{d-1}) @f$ with @f$ \sum_k i_k \leq p @f$ are kept,
+ *           in the order of the components of @ref AnsatzSpace::evaluate. This is the space of
+ *           polynomials of total degree @a p if the @a i-th scalar basis function is of degree
+ *           @a i (eg: monomials).
+ *  @param setSize Number of scalar basis functions along each axis.
+ *  @param polynomialOrder Maximum total degree @a p.
+ */
+template <unsigned Dim>
+DynamicArray<StaticArray<unsigned,Dim>> makeTotalDegreeIndices(unsigned setSize, unsigned polynomialOrder);
+
+
+/** @brief Collect the multi-indices of a serendipity (trunk) set.
+ *  @details Meant for hierarchical bases whose first two functions are the linear vertex functions,
+ *           and whose @a i-th function is a bubble of degree @a i for @f$ 2 \leq i @f$
+ *           (see @ref IntegratedLegendrePolynomial). Multi-indices are kept if the degrees of their
+ *           bubbles sum up to at most @a p, so all vertex functions are included, edge functions up
+ *           to degree @a p, and face or internal functions only up to a total bubble degree of @a p.
+ *           The order matches the components of @ref AnsatzSpace::evaluate.
+ *  @param setSize Number of scalar basis functions along each axis.
+ *  @param polynomialOrder Maximum total bubble degree @a p.
+ */
+template <unsigned Dim>
+DynamicArray<StaticArray<unsigned,Dim>> makeSerendipityIndices(unsigned setSize, unsigned polynomialOrder);
+
+
+/** @brief Collect the multi-indices of a full tensor product set in hierarchical order.
+ *  @details A hierarchical scalar basis (see @ref IntegratedLegendrePolynomial) only appends functions
+ *           as the order grows, but the components of @ref AnsatzSpace::evaluate are strided by the set
+ *           size, so the components of order @a p do not lead those of order @a p+1 in more than one
+ *           dimension. Here, multi-indices are sorted by their largest entry first, and in the order of
+ *           @ref AnsatzSpace::evaluate within equal largest entries. The indices for @a n functions are
+ *           then the leading @f$ n^d @f$ indices for @a n+1 functions, so the element matrices of a
+ *           @ref ReducedAnsatzSpace built on them are the leading blocks of those of the next order.
+ *  @param setSize Number of scalar basis functions along each axis.
+ */
+template <unsigned Dim>
+DynamicArray<StaticArray<unsigned,Dim>> makeHierarchicalIndices(unsigned setSize);
+
+
+/** @brief Map the components of an @ref AnsatzSpace to those of the space with one more scalar function per axis.
+ *  @details Meant for enriching the default component order of @ref AnsatzSpace on a hierarchical scalar
+ *           basis without rebuilding element data from scratch (see @ref makeHierarchicalIndices for an
+ *           order in which no mapping is necessary).
+ *  @param setSize Number of scalar basis functions along each axis of the coarse space.
+ *  @return Index of each of the @f$ n^d @f$ components of the coarse space among the
+ *          @f$ (n+1)^d @f$ components of the enriched one.
+ */
+template <unsigned Dim>
+DynamicArray<unsigned> makeEnrichmentMap(unsigned setSize);
+
+
+
+template <class TScalarExpression, unsigned Dim>
+class ReducedAnsatzSpaceDerivative : public ExpressionTraits<typename TScalarExpression::Value>
+{
+public:
+    static constexpr unsigned Dimension = Dim;
+
+    using typename ExpressionTraits<typename TScalarExpression::Value>::Value;
+
+    using typename ExpressionTraits<Value>::ConstIterator;
+
+    using typename ExpressionTraits<Value>::Iterator;
+
+public:
+    ReducedAnsatzSpaceDerivative() = default;
+
+    /// @brief Evaluate the derivatives, ordered like @ref AnsatzSpaceDerivative::evaluate.
+    void evaluate(ConstIterator itArgumentBegin,
+                  ConstIterator itArgumentEnd,
+                  Iterator itOut) const;
+
+    unsigned size() const noexcept;
+
+    /// @brief Minimum size of the buffer required by @ref evaluate.
+    unsigned getMinBufferSize() const noexcept;
+
+    /// @brief Provide scratch space for @ref evaluate, of at least @ref getMinBufferSize components.
+    /// @see AnsatzSpaceDerivative::setBuffer
+    void setBuffer(std::span<Value> buffer);
+
+private:
+    friend class ReducedAnsatzSpace<TScalarExpression,Dim>;
+
+    ReducedAnsatzSpaceDerivative(Ref<const ReducedAnsatzSpace<TScalarExpression,Dim>> rAnsatzSpace);
+
+private:
+    /// @brief Derivative of the full ansatz space, used for tabulating the scalar basis.
+    AnsatzSpaceDerivative<TScalarExpression,Dim> _derivative;
+
+    /// @brief Multi-indices of the included ansatz functions, shared with the ansatz space.
+    std::shared_ptr<const DynamicArray<StaticArray<unsigned,Dim>>> _pIndices;
+}; // class ReducedAnsatzSpaceDerivative
+
+
+
+/** @brief Subset of the functions of an @ref AnsatzSpace, selected by multi-indices.
+ *  @details A full tensor product space of @a n scalar functions has @f$ n^d @f$ components, many of
+ *           which contribute little to the convergence rate at high orders. A reduced space keeps only
+ *           the products whose multi-indices are listed (see @ref makeTotalDegreeIndices and
+ *           @ref makeSerendipityIndices), in the order they are listed. Scalar basis functions are
+ *           tabulated along each axis exactly like in @ref AnsatzSpace, but products are only formed
+ *           for the kept components, which cuts both the DoF count and the cost of evaluation.
+ *           Listing all components in hierarchical order (see @ref makeHierarchicalIndices) keeps
+ *           the full space, but nests the components of consecutive orders.
+ *
+ *           The reduced space satisfies @ref BufferedExpression and can be passed to
+ *           @ref scanConnectivities and @ref AnsatzMap like a full ansatz space.
+ */
+template <class TScalarExpression, unsigned Dim>
+class ReducedAnsatzSpace : public ExpressionTraits<typename TScalarExpression::Value>
+{
+private:
+    using Base = ExpressionTraits<typename TScalarExpression::Value>;
+
+public:
+    static constexpr unsigned Dimension = Dim;
+
+    using typename Base::Value;
+
+    using typename Base::Iterator;
+
+    using typename Base::ConstIterator;
+
+    using AnsatzSet = typename AnsatzSpace<TScalarExpression,Dim>::AnsatzSet;
+
+    /// @brief Indices of the scalar basis functions along each axis.
+    using Index = StaticArray<unsigned,Dim>;
+
+    using Derivative = ReducedAnsatzSpaceDerivative<TScalarExpression,Dim>;
+
+public:
+    ReducedAnsatzSpace();
+
+    /// @brief Keep the listed components of a full ansatz space.
+    /// @param rAnsatzSpace Full ansatz space, whose scalar basis is shared.
+    /// @param rIndices Multi-indices of the components to keep, in the order they should be evaluated.
+    ReducedAnsatzSpace(Ref<const AnsatzSpace<TScalarExpression,Dim>> rAnsatzSpace,
+                       DynamicArray<Index>&& rIndices);
+
+    void evaluate(ConstIterator itArgumentBegin,
+                  ConstIterator itArgumentEnd,
+                  Iterator itOut) const;
+
+    Derivative makeDerivative() const;
+
+    unsigned size() const noexcept;
+
+    /// @brief Scalar basis functions the ansatz space is built from.
+    Ref<const AnsatzSet> ansatzSet() const noexcept;
+
+    /// @brief Multi-indices of the included components.
+    Ref<const DynamicArray<Index>> indices() const noexcept;
+
+    /// @brief Minimum size of the buffer required by @ref evaluate.
+    unsigned getMinBufferSize() const noexcept;
+
+    /// @brief Provide scratch space for @ref evaluate, of at least @ref getMinBufferSize components.
+    /// @see AnsatzSpace::setBuffer
+    void setBuffer(std::span<Value> buffer);
+
+private:
+    friend class ReducedAnsatzSpaceDerivative<TScalarExpression,Dim>;
+
+    /// @brief Full ansatz space, used for tabulating the scalar basis.
+    AnsatzSpace<TScalarExpression,Dim> _ansatzSpace;
+
+    /// @brief Multi-indices of the included components, shared between copies and derivatives.
+    std::shared_ptr<const DynamicArray<Index>> _pIndices;
+}; // class ReducedAnsatzSpace
+
+
+} // namespace cie::fem::maths
+
+#include "packages/maths/impl/ReducedAnsatzSpace_impl.hpp"
+
+#endif
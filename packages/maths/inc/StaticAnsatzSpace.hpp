@@ -0,0 +1,111 @@
+#ifndef CIE_FEM_STATIC_ANSATZ_SPACE_HPP
+#define CIE_FEM_STATIC_ANSATZ_SPACE_HPP
+
+// --- FEM Includes ---
+#include "packages/maths/inc/Expression.hpp"
+#include "packages/maths/inc/AnsatzSpace.hpp"
+
+// --- Utility Includes ---
+#include "packages/stl_extension/inc/StaticArray.hpp"
+
+
+namespace cie::fem::maths {
+
+
+template <class TScalarExpression, unsigned SetSize, unsigned Dim>
+class StaticAnsatzSpace;
+
+
+template <class TScalarExpression, unsigned SetSize, unsigned Dim>
+class StaticAnsatzSpaceDerivative : public ExpressionTraits<typename TScalarExpression::Value>
+{
+public:
+    static constexpr unsigned Dimension = Dim;
+
+    using typename ExpressionTraits<typename TScalarExpression::Value>::Value;
+
+    using typename ExpressionTraits<Value>::ConstIterator;
+
+    using typename ExpressionTraits<Value>::Iterator;
+
+public:
+    StaticAnsatzSpaceDerivative() noexcept = default;
+
+    /// @brief Evaluate the derivatives in the same order as @ref AnsatzSpaceDerivative::evaluate.
+    void evaluate(ConstIterator itArgumentBegin,
+                  ConstIterator itArgumentEnd,
+                  Iterator itOut) const;
+
+    static constexpr unsigned size() noexcept;
+
+private:
+    friend class StaticAnsatzSpace<TScalarExpression,SetSize,Dim>;
+
+    StaticAnsatzSpaceDerivative(Ref<const StaticAnsatzSpace<TScalarExpression,SetSize,Dim>> rAnsatzSpace);
+
+private:
+    StaticArray<TScalarExpression,SetSize> _ansatzSet;
+
+    StaticArray<typename TScalarExpression::Derivative,SetSize> _derivativeSet;
+}; // class StaticAnsatzSpaceDerivative
+
+
+
+/** @brief @ref AnsatzSpace with the number of scalar basis functions fixed at compile time.
+ *  @details Scalar basis functions are stored inline and evaluated into a buffer on the stack,
+ *           so @ref evaluate neither allocates nor looks up thread-local storage. The loops over
+ *           the cartesian product are nested at compile time, one per dimension, each with a
+ *           trip count of @a SetSize. Components are ordered identically to @ref AnsatzSpace.
+ *  @tparam TScalarExpression Scalar basis function type.
+ *  @tparam SetSize Number of scalar basis functions.
+ *  @tparam Dim Number of spatial dimensions.
+ */
+template <class TScalarExpression, unsigned SetSize, unsigned Dim>
+class StaticAnsatzSpace : public ExpressionTraits<typename TScalarExpression::Value>
+{
+private:
+    using Base = ExpressionTraits<typename TScalarExpression::Value>;
+
+public:
+    static constexpr unsigned Dimension = Dim;
+
+    using typename Base::Value;
+
+    using typename Base::Iterator;
+
+    using typename Base::ConstIterator;
+
+    using AnsatzSet = StaticArray<TScalarExpression,SetSize>;
+
+    using Derivative = StaticAnsatzSpaceDerivative<TScalarExpression,SetSize,Dim>;
+
+public:
+    StaticAnsatzSpace() noexcept = default;
+
+    StaticAnsatzSpace(Ref<const AnsatzSet> rSet);
+
+    /// @brief Copy the basis of a dynamic ansatz space, which must have exactly @a SetSize scalar functions.
+    explicit StaticAnsatzSpace(Ref<const AnsatzSpace<TScalarExpression,Dim>> rAnsatzSpace);
+
+    void evaluate(ConstIterator itArgumentBegin,
+                  ConstIterator itArgumentEnd,
+                  Iterator itOut) const;
+
+    Derivative makeDerivative() const;
+
+    static constexpr unsigned size() noexcept;
+
+    Ref<const AnsatzSet> ansatzSet() const noexcept;
+
+private:
+    friend class StaticAnsatzSpaceDerivative<TScalarExpression,SetSize,Dim>;
+
+    AnsatzSet _set;
+}; // class StaticAnsatzSpace
+
+
+} // namespace cie::fem::maths
+
+#include "packages/maths/impl/StaticAnsatzSpace_impl.hpp"
+
+#endif
@@ -0,0 +1,89 @@
+// --- FEM Includes ---
+#include "packages/maths/inc/BarycentricLagrangeBasis.hpp"
+#include "packages/utilities/inc/template_macros.hpp"
+
+// --- Utility Includes ---
+#include "packages/macros/inc/checks.hpp"
+#include "packages/macros/inc/exceptions.hpp"
+
+// --- STL Includes ---
+#include <iterator> // distance
+#include <cmath> // abs
+#include <algorithm> // copy
+
+
+namespace cie::fem::maths {
+
+
+template <class TValue>
+BarycentricLagrangeBasis<TValue>::BarycentricLagrangeBasis(Ptr<const TValue> pNodeBegin,
+                                                           Ptr<const TValue> pNodeEnd)
+    : _nodes(),
+      _weights()
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const unsigned nodeCount = std::distance(pNodeBegin, pNodeEnd);
+    _nodes.resize(nodeCount);
+    std::copy(pNodeBegin, pNodeEnd, _nodes.begin());
+    _weights.resize(nodeCount, static_cast<TValue>(1));
+
+    // w_k = 1 / prod_{l != k} (x_k - x_l)
+    TValue maxWeight = static_cast<TValue>(0);
+    for (unsigned iNode=0u; iNode<nodeCount; ++iNode) {
+        TValue product = static_cast<TValue>(1);
+        for (unsigned iOther=0u; iOther<nodeCount; ++iOther) {
+            if (iOther != iNode) product *= _nodes[iNode] - _nodes[iOther];
+        }
+        CIE_CHECK(product != static_cast<TValue>(0), "Duplicate node " << _nodes[iNode])
+        _weights[iNode] = static_cast<TValue>(1) / product;
+        maxWeight = std::max(maxWeight, std::abs(_weights[iNode]));
+    } // for iNode in range(nodeCount)
+
+    // The barycentric formula is invariant to a common factor of the weights,
+    // so normalize them to keep high orders clear of overflow.
+    if (nodeCount) {
+        for (auto& rWeight : _weights) rWeight /= maxWeight;
+    }
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TValue>
+BarycentricLagrangePolynomial<TValue>::BarycentricLagrangePolynomial(std::shared_ptr<const Basis> pBasis,
+                                                                     unsigned iFunction)
+    : _pBasis(std::move(pBasis)),
+      _iFunction(iFunction)
+{
+    CIE_CHECK(_pBasis, "Missing basis")
+    CIE_OUT_OF_RANGE_CHECK(_iFunction < _pBasis->size())
+}
+
+
+template <class TValue>
+DynamicArray<BarycentricLagrangePolynomial<TValue>>
+BarycentricLagrangePolynomial<TValue>::makeSet(Ptr<const TValue> pNodeBegin,
+                                               Ptr<const TValue> pNodeEnd)
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const auto pBasis = std::make_shared<const Basis>(pNodeBegin, pNodeEnd);
+    DynamicArray<BarycentricLagrangePolynomial> set;
+    set.reserve(pBasis->size());
+    for (unsigned iFunction=0u; iFunction<pBasis->size(); ++iFunction) {
+        set.emplace_back(pBasis, iFunction);
+    }
+    return set;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+CIE_FEM_INSTANTIATE_NUMERIC_TEMPLATE(BarycentricLagrangeBasis);
+
+
+CIE_FEM_INSTANTIATE_NUMERIC_TEMPLATE(BarycentricLagrangePolynomial);
+
+
+} // namespace cie::fem::maths
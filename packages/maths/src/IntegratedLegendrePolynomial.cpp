@@ -0,0 +1,33 @@
+// --- FEM Includes ---
+#include "packages/maths/inc/IntegratedLegendrePolynomial.hpp"
+#include "packages/utilities/inc/template_macros.hpp"
+
+// --- Utility Includes ---
+#include "packages/macros/inc/exceptions.hpp"
+
+
+namespace cie::fem::maths {
+
+
+template <class TValue>
+DynamicArray<IntegratedLegendrePolynomial<TValue>>
+IntegratedLegendrePolynomial<TValue>::makeSet(unsigned polynomialOrder)
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    DynamicArray<IntegratedLegendrePolynomial> set;
+    set.reserve(polynomialOrder + 1u);
+    for (unsigned index=0u; index<=polynomialOrder; ++index) set.emplace_back(index);
+    return set;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+CIE_FEM_INSTANTIATE_NUMERIC_TEMPLATE(IntegratedLegendrePolynomialDerivative);
+
+
+CIE_FEM_INSTANTIATE_NUMERIC_TEMPLATE(IntegratedLegendrePolynomial);
+
+
+} // namespace cie::fem::maths
@@ -5,10 +5,82 @@
 // --- Utility Includes ---
 #include "packages/macros/inc/exceptions.hpp"
 
+// --- STL Includes ---
+#include <algorithm> // fill
+
+
+// Compile hot kernels for several instruction sets and dispatch at load time.
+// Whole architectures are targeted because "avx2" and "avx512f" alone do not imply FMA.
+// Kernels must be forced inline into the clones, since functions are not inlined
+// across different target architectures otherwise.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    #define CIE_FEM_MULTIVERSIONED __attribute__((target_clones("arch=skylake-avx512", "arch=haswell", "default")))
+    #define CIE_FEM_MULTIVERSIONED_KERNEL __attribute__((always_inline))
+#else
+    #define CIE_FEM_MULTIVERSIONED
+    #define CIE_FEM_MULTIVERSIONED_KERNEL
+#endif
+
 
 namespace cie::fem::maths {
 
 
+namespace {
+
+
+template <class TValue>
+CIE_FEM_MULTIVERSIONED_KERNEL
+inline void hornerBatchImpl(const TValue* __restrict pCoefficientBegin,
+                            unsigned coefficientCount,
+                            const TValue* __restrict pArguments,
+                            unsigned argumentCount,
+                            TValue* __restrict pOut) noexcept
+{
+    if (!coefficientCount) {
+        std::fill(pOut, pOut + argumentCount, static_cast<TValue>(0));
+        return;
+    }
+
+    // The outer loop walks the coefficients once, the inner one
+    // is independent across arguments and maps onto SIMD lanes.
+    // "omp simd" (-fopenmp-simd) vectorizes it regardless of the optimization level's cost model.
+    const TValue leading = pCoefficientBegin[coefficientCount - 1u];
+    for (unsigned iArgument=0u; iArgument<argumentCount; ++iArgument) pOut[iArgument] = leading;
+    for (unsigned iCoefficient=coefficientCount-1u; 0u<iCoefficient--;) {
+        const TValue coefficient = pCoefficientBegin[iCoefficient];
+        #pragma omp simd
+        for (unsigned iArgument=0u; iArgument<argumentCount; ++iArgument) {
+            pOut[iArgument] = pOut[iArgument] * pArguments[iArgument] + coefficient;
+        }
+    } // for iCoefficient in reversed(range(coefficientCount - 1))
+}
+
+
+CIE_FEM_MULTIVERSIONED
+void hornerBatch(const float* pCoefficientBegin,
+                 unsigned coefficientCount,
+                 const float* pArguments,
+                 unsigned argumentCount,
+                 float* pOut) noexcept
+{
+    hornerBatchImpl(pCoefficientBegin, coefficientCount, pArguments, argumentCount, pOut);
+}
+
+
+CIE_FEM_MULTIVERSIONED
+void hornerBatch(const double* pCoefficientBegin,
+                 unsigned coefficientCount,
+                 const double* pArguments,
+                 unsigned argumentCount,
+                 double* pOut) noexcept
+{
+    hornerBatchImpl(pCoefficientBegin, coefficientCount, pArguments, argumentCount, pOut);
+}
+
+
+} // anonymous namespace
+
+
 template <class TValue>
 Polynomial<TValue>::Polynomial(RightRef<Coefficients> rCoefficients) noexcept
     : _coefficients(std::move(rCoefficients))
@@ -42,6 +114,19 @@ Polynomial<TValue> Polynomial<TValue>::makeDerivative() const
 }
 
 
+template <class TValue>
+void Polynomial<TValue>::evaluateBatch(ConstIterator itArgumentBegin,
+                                       unsigned argumentCount,
+                                       Iterator itOut) const
+{
+    hornerBatch(_coefficients.data(),
+                _coefficients.size(),
+                itArgumentBegin,
+                argumentCount,
+                itOut);
+}
+
+
 CIE_FEM_INSTANTIATE_NUMERIC_TEMPLATE(Polynomial);
 
 
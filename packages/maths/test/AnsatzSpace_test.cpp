@@ -88,6 +88,44 @@ CIE_TEST_CASE( "AnsatzSpace", "[maths]" )
     CIE_TEST_CHECK(results[6] == Approx(-405.0));
     CIE_TEST_CHECK(results[7] == Approx(486.0));
     CIE_TEST_CHECK(results[8] == Approx(9801.0));
+
+    // Batched evaluation must match pointwise evaluation in both layouts
+    {
+        CIE_TEST_CASE_INIT("evaluateBatch")
+        const DynamicArray<Point> points {p0, p1, p2, p3, Point {0.25, -0.5}};
+        const unsigned pointCount = points.size();
+        DynamicArray<double> basisMajor(pointCount * ansatzSpace.size()), pointMajor(basisMajor.size());
+        CIE_TEST_CHECK_NOTHROW(ansatzSpace.evaluateBatch(points.front().data(), pointCount, basisMajor.data()));
+        CIE_TEST_CHECK_NOTHROW(ansatzSpace.evaluateBatch(points.front().data(), pointCount, pointMajor.data(), BatchLayout::PointMajor));
+
+        for (unsigned iPoint=0u; iPoint<pointCount; ++iPoint) {
+            ansatzSpace.evaluate(points[iPoint].data(), points[iPoint].data() + points[iPoint].size(), results.data());
+            for (unsigned iFunction=0u; iFunction<results.size(); ++iFunction) {
+                CIE_TEST_CHECK(basisMajor[iFunction * pointCount + iPoint] == Approx(results[iFunction]));
+                CIE_TEST_CHECK(pointMajor[iPoint * results.size() + iFunction] == Approx(results[iFunction]));
+            }
+        }
+    }
+
+    // Copies share the basis and evaluate into caller-provided buffers
+    {
+        CIE_TEST_CASE_INIT("setBuffer")
+        static_assert(BufferedExpression<AnsatzSpace>);
+        AnsatzSpace copy = ansatzSpace;
+        CIE_TEST_CHECK(&copy.ansatzSet() == &ansatzSpace.ansatzSet());
+        CIE_TEST_REQUIRE(copy.getMinBufferSize() == 6);
+
+        DynamicArray<double> scratch(copy.getMinBufferSize());
+        CIE_TEST_CHECK_NOTHROW(copy.setBuffer({scratch.data(), scratch.size()}));
+        StaticArray<double,9> reference;
+        for (const Point& rPoint : {p0, p3, Point {0.25, -0.5}}) {
+            ansatzSpace.evaluate(rPoint.data(), rPoint.data() + rPoint.size(), reference.data());
+            CIE_TEST_CHECK_NOTHROW(copy.evaluate(rPoint.data(), rPoint.data() + rPoint.size(), results.data()));
+            for (unsigned iFunction=0u; iFunction<results.size(); ++iFunction) {
+                CIE_TEST_CHECK(results[iFunction] == Approx(reference[iFunction]));
+            }
+        }
+    }
 }
 
 
@@ -164,6 +202,44 @@ CIE_TEST_CASE( "AnsatzSpaceDerivative", "[maths]" )
     CIE_TEST_CHECK(buffer(1, 1) == Approx(-0.75));
     CIE_TEST_CHECK(buffer(2, 1) == Approx(-0.25));
     CIE_TEST_CHECK(buffer(3, 1) == Approx( 0.75));
+
+    // Batched evaluation must match pointwise evaluation in both layouts
+    {
+        CIE_TEST_CASE_INIT("evaluateBatch")
+        const DynamicArray<Point> points {p0, p1, p2, p3, Point {0.25, -0.5}};
+        const unsigned pointCount = points.size();
+        const unsigned size = ansatzDerivative.size();
+        DynamicArray<double> basisMajor(pointCount * size), pointMajor(basisMajor.size());
+        CIE_TEST_CHECK_NOTHROW(ansatzDerivative.evaluateBatch(points.front().data(), pointCount, basisMajor.data()));
+        CIE_TEST_CHECK_NOTHROW(ansatzDerivative.evaluateBatch(points.front().data(), pointCount, pointMajor.data(), BatchLayout::PointMajor));
+
+        for (unsigned iPoint=0u; iPoint<pointCount; ++iPoint) {
+            ansatzDerivative.evaluate(points[iPoint].begin(), points[iPoint].end(), buffer.data());
+            for (unsigned iComponent=0u; iComponent<size; ++iComponent) {
+                CIE_TEST_CHECK(basisMajor[iComponent * pointCount + iPoint] == Approx(buffer.data()[iComponent]));
+                CIE_TEST_CHECK(pointMajor[iPoint * size + iComponent] == Approx(buffer.data()[iComponent]));
+            }
+        }
+    }
+
+    // Evaluate into a caller-provided buffer
+    {
+        CIE_TEST_CASE_INIT("setBuffer")
+        static_assert(BufferedExpression<AnsatzSpace::Derivative>);
+        auto copy = ansatzDerivative;
+        CIE_TEST_REQUIRE(copy.getMinBufferSize() == 8);
+
+        DynamicArray<double> scratch(copy.getMinBufferSize());
+        CIE_TEST_CHECK_NOTHROW(copy.setBuffer({scratch.data(), scratch.size()}));
+        DynamicArray<double> reference(copy.size()), result(copy.size());
+        for (const Point& rPoint : {p0, p3, Point {0.25, -0.5}}) {
+            ansatzDerivative.evaluate(rPoint.begin(), rPoint.end(), reference.data());
+            CIE_TEST_CHECK_NOTHROW(copy.evaluate(rPoint.begin(), rPoint.end(), result.data()));
+            for (unsigned iComponent=0u; iComponent<result.size(); ++iComponent) {
+                CIE_TEST_CHECK(result[iComponent] == Approx(reference[iComponent]));
+            }
+        }
+    }
 }
 
 
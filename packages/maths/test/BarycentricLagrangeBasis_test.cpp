@@ -0,0 +1,183 @@
+// --- Internal Includes ---
+#include "packages/maths/inc/BarycentricLagrangeBasis.hpp"
+#include "packages/maths/inc/LagrangePolynomial.hpp"
+#include "packages/maths/inc/AnsatzSpace.hpp"
+
+// --- Utility Includes ---
+#include "packages/testing/inc/essentials.hpp"
+#include "packages/stl_extension/inc/DynamicArray.hpp"
+#include "packages/stl_extension/inc/StaticArray.hpp"
+
+// --- STL Includes ---
+#include <cmath> // cos
+
+
+namespace cie::fem::maths {
+
+
+CIE_TEST_CASE("BarycentricLagrangeBasis", "[maths]")
+{
+    CIE_TEST_CASE_INIT("BarycentricLagrangeBasis")
+
+    const DynamicArray<double> nodes {0.0, 1.0/4.0, 3.0/4.0, 1.0};
+    const DynamicArray<double> samples {-0.5, 0.0, 0.1, 0.25, 0.25 + 1e-13, 0.5, 0.75, 0.9, 1.0, 1.5};
+
+    const DynamicArray<double> duplicateNodes {0.0, 1.0, 0.0};
+    CIE_TEST_CHECK_THROWS(BarycentricLagrangeBasis<double>(duplicateNodes.data(), duplicateNodes.data() + duplicateNodes.size()));
+    CIE_TEST_REQUIRE_NOTHROW(BarycentricLagrangePolynomial<double>::makeSet(nodes.data(), nodes.data() + nodes.size()));
+    const auto set = BarycentricLagrangePolynomial<double>::makeSet(nodes.data(), nodes.data() + nodes.size());
+    CIE_TEST_REQUIRE(set.size() == nodes.size());
+    CIE_TEST_REQUIRE(set.front().basis().size() == nodes.size());
+
+    {
+        CIE_TEST_CASE_INIT("compare with monomial Lagrange polynomials")
+        for (unsigned iFunction=0u; iFunction<nodes.size(); ++iFunction) {
+            const LagrangePolynomial<double> reference(nodes.data(), nodes.data() + nodes.size(), iFunction);
+            const auto referenceDerivative = reference.makeDerivative();
+            const auto derivative = set[iFunction].makeDerivative();
+            CIE_TEST_CHECK(set[iFunction].index() == iFunction);
+
+            for (const double sample : samples) {
+                double value, expected;
+                reference.evaluate(&sample, &sample + 1, &expected);
+                set[iFunction].evaluate(&sample, &sample + 1, &value);
+                CIE_TEST_CHECK(value == Approx(expected).margin(1e-12));
+
+                referenceDerivative.evaluate(&sample, &sample + 1, &expected);
+                derivative.evaluate(&sample, &sample + 1, &value);
+                CIE_TEST_CHECK(value == Approx(expected).margin(1e-12));
+
+                StaticArray<double,2> valueAndDerivative;
+                set[iFunction].evaluateDerivatives(sample, 1u, valueAndDerivative.data());
+                CIE_TEST_CHECK(valueAndDerivative[1] == Approx(expected).margin(1e-12));
+            } // for sample in samples
+        } // for iFunction in range(nodes.size())
+    }
+
+    {
+        CIE_TEST_CASE_INIT("set evaluation")
+        DynamicArray<double> values(set.size()), derivatives(set.size()), expected(2);
+        for (const double sample : samples) {
+            BarycentricLagrangePolynomial<double>::evaluateSetDerivatives(set, sample, values.data(), derivatives.data());
+            for (unsigned iFunction=0u; iFunction<set.size(); ++iFunction) {
+                set[iFunction].evaluateDerivatives(sample, 1u, expected.data());
+                CIE_TEST_CHECK(values[iFunction] == Approx(expected[0]).margin(1e-14));
+                CIE_TEST_CHECK(derivatives[iFunction] == Approx(expected[1]).margin(1e-12));
+            }
+
+            // Incomplete sets are evaluated function by function
+            const DynamicArray<BarycentricLagrangePolynomial<double>> subset {set[2], set[0]};
+            BarycentricLagrangePolynomial<double>::evaluateSet(subset, sample, values.data());
+            set[2].evaluate(&sample, &sample + 1, expected.data());
+            set[0].evaluate(&sample, &sample + 1, expected.data() + 1);
+            CIE_TEST_CHECK(values[0] == Approx(expected[0]).margin(1e-14));
+            CIE_TEST_CHECK(values[1] == Approx(expected[1]).margin(1e-14));
+        } // for sample in samples
+    }
+}
+
+
+CIE_TEST_CASE("BarycentricLagrangeBasis high order", "[maths]")
+{
+    CIE_TEST_CASE_INIT("BarycentricLagrangeBasis high order")
+
+    // Chebyshev-Lobatto nodes of order 30
+    const unsigned nodeCount = 31u;
+    DynamicArray<double> nodes(nodeCount);
+    for (unsigned iNode=0u; iNode<nodeCount; ++iNode) nodes[iNode] = -std::cos(M_PI * iNode / (nodeCount - 1u));
+
+    const BarycentricLagrangeBasis<double> basis(nodes.data(), nodes.data() + nodes.size());
+    DynamicArray<double> values(nodeCount), derivatives(nodeCount);
+
+    // Kronecker property at the nodes
+    for (unsigned iNode=0u; iNode<nodeCount; ++iNode) {
+        basis.evaluate(nodes[iNode], values.data());
+        for (unsigned iFunction=0u; iFunction<nodeCount; ++iFunction) {
+            CIE_TEST_CHECK(values[iFunction] == Approx(iFunction == iNode ? 1.0 : 0.0).margin(1e-14));
+        }
+    }
+
+    // Interpolate a cubic and its derivative, also right next to the nodes
+    DynamicArray<double> samples {-1.0, -0.999, -0.3, 0.0, 0.123, 0.77, 1.0};
+    for (unsigned iNode=0u; iNode<nodeCount; iNode+=5u) samples.push_back(nodes[iNode] + 1e-11);
+
+    for (const double sample : samples) {
+        basis.evaluateDerivatives(sample, values.data(), derivatives.data());
+        double sum = 0.0, derivativeSum = 0.0, cubic = 0.0, cubicDerivative = 0.0;
+        for (unsigned iFunction=0u; iFunction<nodeCount; ++iFunction) {
+            const double nodalValue = nodes[iFunction] * nodes[iFunction] * nodes[iFunction];
+            sum += values[iFunction];
+            derivativeSum += derivatives[iFunction];
+            cubic += nodalValue * values[iFunction];
+            cubicDerivative += nodalValue * derivatives[iFunction];
+        }
+        CIE_TEST_CHECK(sum == Approx(1.0).epsilon(1e-12));
+        CIE_TEST_CHECK(derivativeSum == Approx(0.0).margin(1e-10));
+        CIE_TEST_CHECK(cubic == Approx(sample * sample * sample).margin(1e-12));
+        CIE_TEST_CHECK(cubicDerivative == Approx(3.0 * sample * sample).margin(1e-10));
+    } // for sample in samples
+}
+
+
+CIE_TEST_CASE("BarycentricLagrangeBasis AnsatzSpace", "[maths]")
+{
+    CIE_TEST_CASE_INIT("BarycentricLagrangeBasis AnsatzSpace")
+
+    const DynamicArray<double> nodes {-1.0, -0.5, 0.25, 1.0};
+    DynamicArray<LagrangePolynomial<double>> referenceSet;
+    for (unsigned iFunction=0u; iFunction<nodes.size(); ++iFunction) {
+        referenceSet.emplace_back(nodes.data(), nodes.data() + nodes.size(), iFunction);
+    }
+
+    const AnsatzSpace<LagrangePolynomial<double>,2> reference(referenceSet);
+    const AnsatzSpace<BarycentricLagrangePolynomial<double>,2> ansatzSpace(
+        BarycentricLagrangePolynomial<double>::makeSet(nodes.data(), nodes.data() + nodes.size()));
+    const auto referenceDerivative = reference.makeDerivative();
+    const auto derivative = ansatzSpace.makeDerivative();
+    CIE_TEST_REQUIRE(ansatzSpace.size() == reference.size());
+    CIE_TEST_REQUIRE(derivative.size() == referenceDerivative.size());
+
+    const DynamicArray<double> points {-1.0, -1.0,
+                                        0.3, -0.5,
+                                       -0.7,  0.9,
+                                        1.0,  0.25};
+    const unsigned pointCount = points.size() / 2;
+
+    DynamicArray<double> values(ansatzSpace.size()), expected(ansatzSpace.size());
+    DynamicArray<double> derivatives(derivative.size()), expectedDerivatives(derivative.size());
+    for (unsigned iPoint=0u; iPoint<pointCount; ++iPoint) {
+        const auto itPoint = points.data() + 2 * iPoint;
+        ansatzSpace.evaluate(itPoint, itPoint + 2, values.data());
+        reference.evaluate(itPoint, itPoint + 2, expected.data());
+        for (unsigned iComponent=0u; iComponent<values.size(); ++iComponent) {
+            CIE_TEST_CHECK(values[iComponent] == Approx(expected[iComponent]).margin(1e-12));
+        }
+
+        derivative.evaluate(itPoint, itPoint + 2, derivatives.data());
+        referenceDerivative.evaluate(itPoint, itPoint + 2, expectedDerivatives.data());
+        for (unsigned iComponent=0u; iComponent<derivatives.size(); ++iComponent) {
+            CIE_TEST_CHECK(derivatives[iComponent] == Approx(expectedDerivatives[iComponent]).margin(1e-12));
+        }
+    } // for iPoint in range(pointCount)
+
+    {
+        CIE_TEST_CASE_INIT("batch")
+        DynamicArray<double> batch(ansatzSpace.size() * pointCount), expectedBatch(batch.size());
+        ansatzSpace.evaluateBatch(points.data(), pointCount, batch.data(), BatchLayout::PointMajor);
+        reference.evaluateBatch(points.data(), pointCount, expectedBatch.data(), BatchLayout::PointMajor);
+        for (unsigned iComponent=0u; iComponent<batch.size(); ++iComponent) {
+            CIE_TEST_CHECK(batch[iComponent] == Approx(expectedBatch[iComponent]).margin(1e-12));
+        }
+
+        batch.resize(derivative.size() * pointCount);
+        expectedBatch.resize(batch.size());
+        derivative.evaluateBatch(points.data(), pointCount, batch.data());
+        referenceDerivative.evaluateBatch(points.data(), pointCount, expectedBatch.data());
+        for (unsigned iComponent=0u; iComponent<batch.size(); ++iComponent) {
+            CIE_TEST_CHECK(batch[iComponent] == Approx(expectedBatch[iComponent]).margin(1e-12));
+        }
+    }
+}
+
+
+} // namespace cie::fem::maths
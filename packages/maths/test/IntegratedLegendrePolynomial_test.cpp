@@ -0,0 +1,247 @@
+// --- Internal Includes ---
+#include "packages/maths/inc/IntegratedLegendrePolynomial.hpp"
+#include "packages/maths/inc/AnsatzSpace.hpp"
+#include "packages/maths/inc/ReducedAnsatzSpace.hpp"
+#include "packages/numeric/inc/GaussLegendreQuadrature.hpp"
+
+// --- Utility Includes ---
+#include "packages/testing/inc/essentials.hpp"
+#include "packages/stl_extension/inc/DynamicArray.hpp"
+#include "packages/stl_extension/inc/StaticArray.hpp"
+
+// --- STL Includes ---
+#include <cmath> // sqrt
+#include <algorithm> // equal
+
+
+namespace cie::fem::maths {
+
+
+namespace {
+
+
+/// @brief Integrate the Laplace stiffness matrix of a 2D ansatz space on [-1, 1]^2.
+template <class TAnsatzSpace>
+DynamicArray<double> makeStiffness(Ref<const TAnsatzSpace> rAnsatzSpace, unsigned nodeCount)
+{
+    const auto derivative = rAnsatzSpace.makeDerivative();
+    const unsigned size = rAnsatzSpace.size();
+    const GaussLegendreQuadrature<double> quadrature(nodeCount);
+
+    DynamicArray<double> stiffness(size * size, 0.0), gradients(derivative.size());
+    for (unsigned iNode=0u; iNode<nodeCount; ++iNode) {
+        for (unsigned jNode=0u; jNode<nodeCount; ++jNode) {
+            const StaticArray<double,2> point {quadrature.nodes()[iNode], quadrature.nodes()[jNode]};
+            const double weight = quadrature.weights()[iNode] * quadrature.weights()[jNode];
+            derivative.evaluate(point.data(), point.data() + point.size(), gradients.data());
+            for (unsigned iRow=0u; iRow<size; ++iRow) {
+                for (unsigned iColumn=0u; iColumn<size; ++iColumn) {
+                    stiffness[iRow * size + iColumn] += weight * (gradients[iRow] * gradients[iColumn]
+                                                                  + gradients[size + iRow] * gradients[size + iColumn]);
+                }
+            }
+        } // for jNode in range(nodeCount)
+    } // for iNode in range(nodeCount)
+
+    return stiffness;
+}
+
+
+} // unnamed namespace
+
+
+CIE_TEST_CASE("IntegratedLegendrePolynomial", "[maths]")
+{
+    CIE_TEST_CASE_INIT("IntegratedLegendrePolynomial")
+
+    using Basis = IntegratedLegendrePolynomial<double>;
+    const DynamicArray<double> samples {-1.0, -0.7, -0.2, 0.0, 0.35, 0.9, 1.0};
+    const auto set = Basis::makeSet(6u);
+    CIE_TEST_REQUIRE(set.size() == 7u);
+
+    {
+        CIE_TEST_CASE_INIT("closed forms")
+        for (const double x : samples) {
+            StaticArray<double,4> values;
+            for (unsigned iFunction=0u; iFunction<values.size(); ++iFunction) {
+                set[iFunction].evaluate(&x, &x + 1, values.data() + iFunction);
+            }
+            CIE_TEST_CHECK(values[0] == Approx(0.5 * (1.0 - x)));
+            CIE_TEST_CHECK(values[1] == Approx(0.5 * (1.0 + x)));
+            CIE_TEST_CHECK(values[2] == Approx(1.5 * (x * x - 1.0) / std::sqrt(6.0)).margin(1e-14));
+            CIE_TEST_CHECK(values[3] == Approx(2.5 * (x * x * x - x) / std::sqrt(10.0)).margin(1e-14));
+        }
+
+        // Bubbles vanish at both ends
+        for (unsigned iFunction=2u; iFunction<set.size(); ++iFunction) {
+            for (const double x : {-1.0, 1.0}) {
+                double value;
+                set[iFunction].evaluate(&x, &x + 1, &value);
+                CIE_TEST_CHECK(value == Approx(0.0).margin(1e-14));
+            }
+        }
+    }
+
+    {
+        CIE_TEST_CASE_INIT("derivatives")
+        const double delta = 1e-6;
+        for (const auto& rFunction : set) {
+            const auto derivative = rFunction.makeDerivative();
+            for (const double x : samples) {
+                double left, right, expected;
+                const double xLeft = x - delta, xRight = x + delta;
+                rFunction.evaluate(&xLeft, &xLeft + 1, &left);
+                rFunction.evaluate(&xRight, &xRight + 1, &right);
+                derivative.evaluate(&x, &x + 1, &expected);
+                CIE_TEST_CHECK(expected == Approx((right - left) / (2.0 * delta)).margin(1e-8));
+
+                StaticArray<double,2> valueAndDerivative;
+                rFunction.evaluateDerivatives(x, 1u, valueAndDerivative.data());
+                CIE_TEST_CHECK(valueAndDerivative[1] == Approx(expected).margin(1e-14));
+            } // for x in samples
+        } // for rFunction in set
+    }
+
+    {
+        CIE_TEST_CASE_INIT("set evaluation")
+        DynamicArray<double> values(set.size()), derivatives(set.size());
+        StaticArray<double,2> expected;
+        for (const double x : samples) {
+            Basis::evaluateSetDerivatives(set, x, values.data(), derivatives.data());
+            for (unsigned iFunction=0u; iFunction<set.size(); ++iFunction) {
+                set[iFunction].evaluateDerivatives(x, 1u, expected.data());
+                CIE_TEST_CHECK(values[iFunction] == Approx(expected[0]).margin(1e-14));
+                CIE_TEST_CHECK(derivatives[iFunction] == Approx(expected[1]).margin(1e-14));
+            }
+
+            // Incomplete sets are evaluated function by function
+            const DynamicArray<Basis> subset {set[4], set[1]};
+            Basis::evaluateSet(subset, x, values.data());
+            set[4].evaluate(&x, &x + 1, expected.data());
+            set[1].evaluate(&x, &x + 1, expected.data() + 1);
+            CIE_TEST_CHECK(values[0] == Approx(expected[0]).margin(1e-14));
+            CIE_TEST_CHECK(values[1] == Approx(expected[1]).margin(1e-14));
+        } // for x in samples
+    }
+
+    {
+        CIE_TEST_CASE_INIT("hierarchy")
+        const auto refinedSet = Basis::makeSet(9u);
+        DynamicArray<double> values(set.size()), refinedValues(refinedSet.size());
+        for (const double x : samples) {
+            Basis::evaluateSet(set, x, values.data());
+            Basis::evaluateSet(refinedSet, x, refinedValues.data());
+            for (unsigned iFunction=0u; iFunction<set.size(); ++iFunction) {
+                CIE_TEST_CHECK(values[iFunction] == refinedValues[iFunction]);
+            }
+        }
+    }
+
+    {
+        CIE_TEST_CASE_INIT("orthonormal bubble derivatives")
+        const GaussLegendreQuadrature<double> quadrature(set.size());
+        DynamicArray<double> values(set.size()), derivatives(set.size());
+        DynamicArray<double> stiffness(set.size() * set.size(), 0.0);
+        for (unsigned iNode=0u; iNode<quadrature.nodes().size(); ++iNode) {
+            Basis::evaluateSetDerivatives(set, quadrature.nodes()[iNode], values.data(), derivatives.data());
+            for (unsigned iRow=0u; iRow<set.size(); ++iRow) {
+                for (unsigned iColumn=0u; iColumn<set.size(); ++iColumn) {
+                    stiffness[iRow * set.size() + iColumn] += quadrature.weights()[iNode] * derivatives[iRow] * derivatives[iColumn];
+                }
+            }
+        } // for iNode in range(nodeCount)
+
+        for (unsigned iRow=2u; iRow<set.size(); ++iRow) {
+            for (unsigned iColumn=0u; iColumn<set.size(); ++iColumn) {
+                CIE_TEST_CHECK(stiffness[iRow * set.size() + iColumn] == Approx(iRow == iColumn ? 1.0 : 0.0).margin(1e-13));
+            }
+        }
+    }
+}
+
+
+CIE_TEST_CASE("IntegratedLegendrePolynomial AnsatzSpace", "[maths]")
+{
+    CIE_TEST_CASE_INIT("IntegratedLegendrePolynomial AnsatzSpace")
+
+    using Basis = IntegratedLegendrePolynomial<double>;
+    const auto set = Basis::makeSet(3u);
+    const AnsatzSpace<Basis,2> ansatzSpace(set);
+    const auto derivative = ansatzSpace.makeDerivative();
+    CIE_TEST_REQUIRE(ansatzSpace.size() == 16u);
+
+    const StaticArray<double,2> point {0.3, -0.6};
+    DynamicArray<double> values(ansatzSpace.size()), derivatives(derivative.size());
+    ansatzSpace.evaluate(point.data(), point.data() + point.size(), values.data());
+    derivative.evaluate(point.data(), point.data() + point.size(), derivatives.data());
+
+    // The first index varies fastest
+    for (unsigned j=0u; j<set.size(); ++j) {
+        for (unsigned i=0u; i<set.size(); ++i) {
+            StaticArray<double,2> x, y;
+            set[i].evaluateDerivatives(point[0], 1u, x.data());
+            set[j].evaluateDerivatives(point[1], 1u, y.data());
+            const unsigned iComponent = j * set.size() + i;
+            CIE_TEST_CHECK(values[iComponent] == Approx(x[0] * y[0]).margin(1e-14));
+            CIE_TEST_CHECK(derivatives[iComponent] == Approx(x[1] * y[0]).margin(1e-14));
+            CIE_TEST_CHECK(derivatives[ansatzSpace.size() + iComponent] == Approx(x[0] * y[1]).margin(1e-14));
+        }
+    }
+}
+
+
+
+CIE_TEST_CASE("IntegratedLegendrePolynomial enrichment", "[maths]")
+{
+    CIE_TEST_CASE_INIT("IntegratedLegendrePolynomial enrichment")
+
+    // Quadratic and cubic spaces, integrated exactly by 4 nodes per axis
+    using Basis = IntegratedLegendrePolynomial<double>;
+    const unsigned polynomialOrder = 2u;
+    const unsigned setSize = polynomialOrder + 1u;
+    const unsigned nodeCount = setSize + 1u;
+    const AnsatzSpace<Basis,2> coarse(Basis::makeSet(polynomialOrder));
+    const AnsatzSpace<Basis,2> fine(Basis::makeSet(polynomialOrder + 1u));
+
+    {
+        CIE_TEST_CASE_INIT("default component order")
+        const auto map = makeEnrichmentMap<2>(setSize);
+        CIE_TEST_REQUIRE(map.size() == coarse.size());
+
+        // N_0(x) N_1(y) is the 4th component of the quadratic space, but the 5th of the cubic one
+        CIE_TEST_CHECK(map[setSize] == setSize + 1u);
+
+        const auto coarseStiffness = makeStiffness(coarse, nodeCount);
+        const auto fineStiffness = makeStiffness(fine, nodeCount);
+        for (unsigned iRow=0u; iRow<coarse.size(); ++iRow) {
+            for (unsigned iColumn=0u; iColumn<coarse.size(); ++iColumn) {
+                CIE_TEST_CHECK(coarseStiffness[iRow * coarse.size() + iColumn]
+                               == Approx(fineStiffness[map[iRow] * fine.size() + map[iColumn]]).margin(1e-13));
+            }
+        }
+    }
+
+    {
+        CIE_TEST_CASE_INIT("hierarchical component order")
+        const ReducedAnsatzSpace<Basis,2> hierarchicalCoarse(coarse, makeHierarchicalIndices<2>(setSize));
+        const ReducedAnsatzSpace<Basis,2> hierarchicalFine(fine, makeHierarchicalIndices<2>(setSize + 1u));
+        CIE_TEST_REQUIRE(hierarchicalCoarse.size() == coarse.size());
+        CIE_TEST_REQUIRE(hierarchicalFine.size() == fine.size());
+        CIE_TEST_CHECK(std::equal(hierarchicalCoarse.indices().begin(),
+                                  hierarchicalCoarse.indices().end(),
+                                  hierarchicalFine.indices().begin()));
+
+        // The quadratic stiffness matrix is the leading block of the cubic one
+        const auto coarseStiffness = makeStiffness(hierarchicalCoarse, nodeCount);
+        const auto fineStiffness = makeStiffness(hierarchicalFine, nodeCount);
+        for (unsigned iRow=0u; iRow<coarse.size(); ++iRow) {
+            for (unsigned iColumn=0u; iColumn<coarse.size(); ++iColumn) {
+                CIE_TEST_CHECK(coarseStiffness[iRow * coarse.size() + iColumn]
+                               == Approx(fineStiffness[iRow * fine.size() + iColumn]).margin(1e-13));
+            }
+        }
+    }
+}
+
+
+} // namespace cie::fem::maths
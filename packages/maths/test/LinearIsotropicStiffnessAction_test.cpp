@@ -0,0 +1,68 @@
+// --- Utility Includes ---
+#include "packages/testing/inc/essentials.hpp"
+
+// --- FEM Includes ---
+#include "packages/maths/inc/Polynomial.hpp"
+#include "packages/maths/inc/AnsatzSpace.hpp"
+#include "packages/maths/inc/LinearIsotropicStiffnessIntegrand.hpp"
+#include "packages/maths/inc/LinearIsotropicStiffnessAction.hpp"
+
+
+namespace cie::fem::maths {
+
+
+CIE_TEST_CASE("LinearIsotropicStiffnessAction", "[maths]")
+{
+    CIE_TEST_CASE_INIT("LinearIsotropicStiffnessAction")
+    using Scalar = double;
+    constexpr unsigned Dimension = 2u;
+
+    using Basis = Polynomial<Scalar>;
+    using Ansatz = AnsatzSpace<Basis,Dimension>;
+
+    // Define a bilinear ansatz space.
+    const Ansatz ansatzSpace(Ansatz::AnsatzSet {
+        Basis({ 0.5,  0.5}),
+        Basis({ 0.5, -0.5})
+    });
+    const auto ansatzDerivatives = ansatzSpace.makeDerivative();
+
+    constexpr Scalar modulus = 10.0;
+    const StaticArray<Scalar,4> coefficients {{1.0, -2.0, 3.0, 0.5}};
+    StaticArray<Scalar,8> actionBuffer, integrandBuffer;
+
+    LinearIsotropicStiffnessAction<Ansatz::Derivative> action(modulus,
+                                                               ansatzDerivatives,
+                                                               {coefficients.data(), coefficients.size()},
+                                                               {actionBuffer.data(), actionBuffer.size()});
+    CIE_TEST_CHECK(action.size() == 4);
+    CIE_TEST_CHECK(action.getMinBufferSize() == 8);
+
+    LinearIsotropicStiffnessIntegrand<Ansatz::Derivative> integrand(modulus,
+                                                                     ansatzDerivatives,
+                                                                     {integrandBuffer.data(), integrandBuffer.size()});
+
+    // The action must match the product of the integrand with the coefficients.
+    for (const auto& rSamplePoint : {StaticArray<Scalar,Dimension> {{-1.0, -1.0}},
+                                     StaticArray<Scalar,Dimension> {{ 1.0, -1.0}},
+                                     StaticArray<Scalar,Dimension> {{ 0.3,  0.7}},
+                                     StaticArray<Scalar,Dimension> {{-0.5,  1.0}}}) {
+        StaticArray<Scalar,4> result;
+        StaticArray<Scalar,16> stiffness;
+        CIE_TEST_CHECK_NOTHROW(action.evaluate(rSamplePoint.data(),
+                                               rSamplePoint.data() + rSamplePoint.size(),
+                                               result.data()));
+        integrand.evaluate(rSamplePoint.data(), rSamplePoint.data() + rSamplePoint.size(), stiffness.data());
+
+        for (unsigned iRow=0u; iRow<4u; ++iRow) {
+            Scalar reference = 0.0;
+            for (unsigned iColumn=0u; iColumn<4u; ++iColumn) {
+                reference += stiffness[4 * iRow + iColumn] * coefficients[iColumn];
+            }
+            CIE_TEST_CHECK(result[iRow] == Approx(reference).margin(1e-14));
+        } // for iRow in range(4)
+    } // for rSamplePoint in samplePoints
+}
+
+
+} // namespace cie::fem::maths
@@ -1,5 +1,6 @@
 // --- Utility Includes ---
 #include "packages/testing/inc/essentials.hpp"
+#include "packages/stl_extension/inc/StaticArray.hpp"
 
 // --- Internal Includes ---
 #include "packages/maths/inc/Polynomial.hpp"
@@ -70,6 +71,59 @@ CIE_TEST_CASE("Polynomial", "[maths]")
                                                        makePtrTo(result)));
             CIE_TEST_CHECK(result == Approx(reference));
         }
+
+        StaticArray<double,2> valueAndDerivative;
+        CIE_TEST_CHECK_NOTHROW(polynomial.evaluateDerivatives(2.0, 1u, valueAndDerivative.data()));
+        CIE_TEST_CHECK(valueAndDerivative[0] == Approx(0.0));
+        CIE_TEST_CHECK(valueAndDerivative[1] == Approx(0.0));
+    }
+
+    // Fused evaluation of the value and derivatives
+    {
+        // 2 - x + 3x^2 + 0.5x^3 - x^4
+        Test polynomial({2.0, -1.0, 3.0, 0.5, -1.0});
+        const auto first = polynomial.makeDerivative();
+        const auto second = first.makeDerivative();
+        const auto third = second.makeDerivative();
+
+        StaticArray<double,6> fused;
+        for (const double argument : {-2.0, -0.5, 0.0, 0.75, 3.0}) {
+            CIE_TEST_CHECK_NOTHROW(polynomial.evaluateDerivatives(argument, 5u, fused.data()));
+            double reference;
+            polynomial.evaluate(makePtrTo(argument), makePtrTo(argument) + 1, makePtrTo(reference));
+            CIE_TEST_CHECK(fused[0] == Approx(reference));
+            first.evaluate(makePtrTo(argument), makePtrTo(argument) + 1, makePtrTo(reference));
+            CIE_TEST_CHECK(fused[1] == Approx(reference));
+            second.evaluate(makePtrTo(argument), makePtrTo(argument) + 1, makePtrTo(reference));
+            CIE_TEST_CHECK(fused[2] == Approx(reference));
+            third.evaluate(makePtrTo(argument), makePtrTo(argument) + 1, makePtrTo(reference));
+            CIE_TEST_CHECK(fused[3] == Approx(reference));
+            CIE_TEST_CHECK(fused[4] == Approx(-24.0));
+            CIE_TEST_CHECK(fused[5] == Approx(0.0).margin(1e-14));
+        }
+    }
+
+    // Batched evaluation, with an argument count that is not a multiple of any SIMD width
+    {
+        const auto check = [] <class TValue> (TValue tolerance) {
+            const Polynomial<TValue> polynomial({TValue(2), TValue(-1), TValue(3), TValue(0.5), TValue(-1)});
+            DynamicArray<TValue> arguments, values(37);
+            for (unsigned iArgument=0u; iArgument<values.size(); ++iArgument) {
+                arguments.push_back(TValue(-1) + TValue(iArgument) / TValue(18));
+            }
+            CIE_TEST_CHECK_NOTHROW(polynomial.evaluateBatch(arguments.data(), arguments.size(), values.data()));
+            for (unsigned iArgument=0u; iArgument<values.size(); ++iArgument) {
+                TValue reference;
+                polynomial.evaluate(arguments.data() + iArgument, arguments.data() + iArgument + 1, &reference);
+                CIE_TEST_CHECK(values[iArgument] == Approx(reference).epsilon(tolerance));
+            }
+
+            const Polynomial<TValue> empty((typename Polynomial<TValue>::Coefficients()));
+            CIE_TEST_CHECK_NOTHROW(empty.evaluateBatch(arguments.data(), arguments.size(), values.data()));
+            for (const TValue value : values) CIE_TEST_CHECK(value == TValue(0));
+        };
+        check(1e-6f);
+        check(1e-12);
     }
 }
 
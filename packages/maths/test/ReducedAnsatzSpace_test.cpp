@@ -0,0 +1,111 @@
+// --- Utility Includes ---
+#include "packages/testing/inc/essentials.hpp"
+
+// --- FEM Includes ---
+#include "packages/maths/inc/ReducedAnsatzSpace.hpp"
+#include "packages/maths/inc/AnsatzSpace.hpp"
+#include "packages/maths/inc/IntegratedLegendrePolynomial.hpp"
+#include "packages/maths/inc/Polynomial.hpp"
+
+// --- STL Includes ---
+#include <algorithm> // find
+
+
+namespace cie::fem::maths {
+
+
+CIE_TEST_CASE("ReducedAnsatzSpace indices", "[maths]")
+{
+    CIE_TEST_CASE_INIT("ReducedAnsatzSpace indices")
+
+    // P3 in 2D and P2 in 3D
+    CIE_TEST_CHECK(makeTotalDegreeIndices<2>(4u, 3u).size() == 10u);
+    CIE_TEST_CHECK(makeTotalDegreeIndices<3>(3u, 2u).size() == 10u);
+    CIE_TEST_CHECK(makeTotalDegreeIndices<2>(0u, 3u).empty());
+
+    // Quad8 and hex20
+    CIE_TEST_CHECK(makeSerendipityIndices<2>(3u, 2u).size() == 8u);
+    CIE_TEST_CHECK(makeSerendipityIndices<3>(3u, 2u).size() == 20u);
+
+    // Trunk space of order 4 on a quad: 4 vertex, 12 edge and 1 internal function
+    const auto indices = makeSerendipityIndices<2>(5u, 4u);
+    CIE_TEST_REQUIRE(indices.size() == 17u);
+
+    // Components are ordered like the full tensor product (first index varies fastest)
+    CIE_TEST_CHECK(indices[0] == StaticArray<unsigned,2> {0u, 0u});
+    CIE_TEST_CHECK(indices[1] == StaticArray<unsigned,2> {1u, 0u});
+    CIE_TEST_CHECK(indices[5] == StaticArray<unsigned,2> {0u, 1u});
+    CIE_TEST_CHECK(indices.back() == StaticArray<unsigned,2> {1u, 4u});
+    CIE_TEST_CHECK(std::find(indices.begin(), indices.end(), StaticArray<unsigned,2> {2u, 2u}) != indices.end());
+    CIE_TEST_CHECK(std::find(indices.begin(), indices.end(), StaticArray<unsigned,2> {2u, 3u}) == indices.end());
+}
+
+
+CIE_TEST_CASE("ReducedAnsatzSpace", "[maths]")
+{
+    CIE_TEST_CASE_INIT("ReducedAnsatzSpace")
+
+    using Basis = IntegratedLegendrePolynomial<double>;
+    const unsigned polynomialOrder = 4u;
+    const AnsatzSpace<Basis,2> full(Basis::makeSet(polynomialOrder));
+    const auto fullDerivative = full.makeDerivative();
+    const unsigned setSize = polynomialOrder + 1u;
+
+    CIE_TEST_CHECK_THROWS(ReducedAnsatzSpace<Basis,2>(full, DynamicArray<StaticArray<unsigned,2>> {{0u, setSize}}));
+
+    const ReducedAnsatzSpace<Basis,2> reduced(full, makeSerendipityIndices<2>(setSize, polynomialOrder));
+    const auto derivative = reduced.makeDerivative();
+    CIE_TEST_REQUIRE(reduced.size() == 17u);
+    CIE_TEST_REQUIRE(derivative.size() == 2u * 17u);
+    CIE_TEST_CHECK(reduced.ansatzSet().size() == setSize);
+
+    const DynamicArray<double> points {-1.0, -1.0,
+                                        0.3, -0.5,
+                                       -0.7,  0.9,
+                                        1.0,  0.25};
+
+    DynamicArray<double> values(reduced.size()), fullValues(full.size());
+    DynamicArray<double> derivatives(derivative.size()), fullDerivatives(fullDerivative.size());
+    for (unsigned iPoint=0u; iPoint<points.size() / 2; ++iPoint) {
+        const auto itPoint = points.data() + 2 * iPoint;
+        reduced.evaluate(itPoint, itPoint + 2, values.data());
+        full.evaluate(itPoint, itPoint + 2, fullValues.data());
+        derivative.evaluate(itPoint, itPoint + 2, derivatives.data());
+        fullDerivative.evaluate(itPoint, itPoint + 2, fullDerivatives.data());
+
+        for (unsigned iComponent=0u; iComponent<reduced.size(); ++iComponent) {
+            const auto& rIndex = reduced.indices()[iComponent];
+            const unsigned iFull = rIndex[0] + setSize * rIndex[1];
+            CIE_TEST_CHECK(values[iComponent] == Approx(fullValues[iFull]).margin(1e-14));
+            CIE_TEST_CHECK(derivatives[iComponent] == Approx(fullDerivatives[iFull]).margin(1e-14));
+            CIE_TEST_CHECK(derivatives[reduced.size() + iComponent] == Approx(fullDerivatives[full.size() + iFull]).margin(1e-14));
+        }
+    } // for iPoint in range(pointCount)
+
+    {
+        CIE_TEST_CASE_INIT("complete index set")
+        using Monomial = Polynomial<double>;
+        const AnsatzSpace<Monomial,3> monomials(DynamicArray<Monomial> {
+            Monomial(Monomial::Coefficients {1.0}),
+            Monomial(Monomial::Coefficients {0.0, 1.0}),
+            Monomial(Monomial::Coefficients {0.0, 0.0, 1.0})
+        });
+        const ReducedAnsatzSpace<Monomial,3> complete(monomials, makeTotalDegreeIndices<3>(3u, 6u));
+        CIE_TEST_REQUIRE(complete.size() == monomials.size());
+
+        ReducedAnsatzSpace<Monomial,3> buffered = complete;
+        DynamicArray<double> buffer(buffered.getMinBufferSize());
+        CIE_TEST_CHECK_NOTHROW(buffered.setBuffer(buffer));
+
+        const StaticArray<double,3> point {0.5, -2.0, 3.0};
+        DynamicArray<double> expected(monomials.size()), result(complete.size());
+        monomials.evaluate(point.data(), point.data() + point.size(), expected.data());
+        buffered.evaluate(point.data(), point.data() + point.size(), result.data());
+        for (unsigned iComponent=0u; iComponent<result.size(); ++iComponent) {
+            CIE_TEST_CHECK(result[iComponent] == Approx(expected[iComponent]));
+        }
+    }
+}
+
+
+} // namespace cie::fem::maths
@@ -0,0 +1,62 @@
+// --- Utility Includes ---
+#include "packages/testing/inc/essentials.hpp"
+
+// --- FEM Includes ---
+#include "packages/maths/inc/StaticAnsatzSpace.hpp"
+#include "packages/maths/inc/AnsatzSpace.hpp"
+#include "packages/maths/inc/Polynomial.hpp"
+
+
+namespace cie::fem::maths {
+
+
+CIE_TEST_CASE("StaticAnsatzSpace", "[maths]")
+{
+    CIE_TEST_CASE_INIT("StaticAnsatzSpace")
+
+    using Basis = Polynomial<double>;
+    using DynamicSpace = AnsatzSpace<Basis,3>;
+    using StaticSpace = StaticAnsatzSpace<Basis,3,3>;
+    static_assert(Expression<StaticSpace>);
+    static_assert(Expression<StaticSpace::Derivative>);
+    static_assert(StaticSpace::size() == 27u);
+
+    const DynamicSpace dynamicSpace(DynamicSpace::AnsatzSet {
+        Basis(Basis::Coefficients {0.5, -0.5}),
+        Basis(Basis::Coefficients {0.5, 0.5}),
+        Basis(Basis::Coefficients {1.0, 0.0, -1.0})
+    });
+    const StaticSpace staticSpace(dynamicSpace);
+    const auto dynamicDerivative = dynamicSpace.makeDerivative();
+    const auto staticDerivative = staticSpace.makeDerivative();
+    CIE_TEST_REQUIRE(staticDerivative.size() == dynamicDerivative.size());
+
+    // Both variants must agree component by component
+    const StaticArray<StaticArray<double,3>,3> points {{
+        {{-1.0, 0.0, 1.0}},
+        {{0.25, -0.5, 0.75}},
+        {{3.0, -2.0, 0.1}}
+    }};
+    StaticArray<double,StaticSpace::size()> reference, result;
+    StaticArray<double,StaticSpace::Derivative::size()> derivativeReference, derivativeResult;
+    for (const auto& rPoint : points) {
+        dynamicSpace.evaluate(rPoint.data(), rPoint.data() + rPoint.size(), reference.data());
+        CIE_TEST_CHECK_NOTHROW(staticSpace.evaluate(rPoint.data(), rPoint.data() + rPoint.size(), result.data()));
+        for (unsigned iComponent=0u; iComponent<result.size(); ++iComponent) {
+            CIE_TEST_CHECK(result[iComponent] == Approx(reference[iComponent]));
+        }
+
+        dynamicDerivative.evaluate(rPoint.data(), rPoint.data() + rPoint.size(), derivativeReference.data());
+        CIE_TEST_CHECK_NOTHROW(staticDerivative.evaluate(rPoint.data(), rPoint.data() + rPoint.size(), derivativeResult.data()));
+        for (unsigned iComponent=0u; iComponent<derivativeResult.size(); ++iComponent) {
+            CIE_TEST_CHECK(derivativeResult[iComponent] == Approx(derivativeReference[iComponent]));
+        }
+    }
+
+    // The basis size is part of the type
+    const AnsatzSpace<Basis,3> tooSmall(AnsatzSpace<Basis,3>::AnsatzSet {Basis(Basis::Coefficients {1.0})});
+    CIE_TEST_CHECK_THROWS(StaticSpace(tooSmall));
+}
+
+
+} // namespace cie::fem::maths
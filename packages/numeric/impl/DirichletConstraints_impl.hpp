@@ -0,0 +1,141 @@
+#ifndef CIE_FEM_NUMERIC_DIRICHLET_CONSTRAINTS_IMPL_HPP
+#define CIE_FEM_NUMERIC_DIRICHLET_CONSTRAINTS_IMPL_HPP
+
+// --- FEM Includes ---
+#include "packages/numeric/inc/DirichletConstraints.hpp"
+
+// --- Utility Includes ---
+#include "packages/macros/inc/exceptions.hpp"
+#include "packages/macros/inc/checks.hpp"
+#include "packages/concurrency/inc/ParallelFor.hpp"
+
+// --- STL Includes ---
+#include <atomic> // atomic
+
+
+namespace cie::fem {
+
+
+template <class TValue>
+DirichletConstraints<TValue>::DirichletConstraints() noexcept
+    : DirichletConstraints(0ul)
+{
+}
+
+
+template <class TValue>
+DirichletConstraints<TValue>::DirichletConstraints(std::size_t dofCount)
+    : _mask((dofCount + _wordSize - 1) / _wordSize, static_cast<Word>(0)),
+      _values(dofCount, static_cast<TValue>(0)),
+      _constraintCount(0ul)
+{
+}
+
+
+template <class TValue>
+void DirichletConstraints<TValue>::addConstraint(std::size_t iDoF, TValue value)
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+    CIE_OUT_OF_RANGE_CHECK(iDoF < this->dofCount())
+    if (!this->isConstrained(iDoF)) {
+        _mask[iDoF / _wordSize] |= static_cast<Word>(1) << (iDoF % _wordSize);
+        ++_constraintCount;
+    }
+    _values[iDoF] = value;
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TValue>
+inline bool DirichletConstraints<TValue>::isConstrained(std::size_t iDoF) const noexcept
+{
+    return iDoF < this->dofCount() && (_mask[iDoF / _wordSize] >> (iDoF % _wordSize)) & static_cast<Word>(1);
+}
+
+
+template <class TValue>
+TValue DirichletConstraints<TValue>::getValue(std::size_t iDoF) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+    CIE_CHECK(this->isConstrained(iDoF), "DoF " << iDoF << " is not constrained")
+    return _values[iDoF];
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TValue>
+std::size_t DirichletConstraints<TValue>::size() const noexcept
+{
+    return _constraintCount;
+}
+
+
+template <class TValue>
+std::size_t DirichletConstraints<TValue>::dofCount() const noexcept
+{
+    return _values.size();
+}
+
+
+template <class TValue>
+template <class TIndex>
+void DirichletConstraints<TValue>::apply(Ref<const DynamicArray<TIndex>> rRowExtents,
+                                         Ref<const DynamicArray<TIndex>> rColumnIndices,
+                                         Ref<DynamicArray<TValue>> rNonzeros,
+                                         Ptr<TValue> pRhs,
+                                         ConstraintImposition imposition,
+                                         OptionalRef<mp::ThreadPoolBase> rThreadPool) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    if (rRowExtents.empty()) return;
+    const std::size_t rowCount = rRowExtents.size() - 1;
+    CIE_OUT_OF_RANGE_CHECK(rowCount == this->dofCount())
+    CIE_OUT_OF_RANGE_CHECK(rColumnIndices.size() == rNonzeros.size())
+
+    const bool eliminateColumns = imposition == ConstraintImposition::SymmetricElimination;
+    std::atomic<bool> missingDiagonal = false;
+
+    // Each job only writes to its own row of the matrix and the right hand side
+    const auto job = [this, &rRowExtents, &rColumnIndices, &rNonzeros, pRhs, eliminateColumns, &missingDiagonal](std::size_t iRow) -> void {
+        const TIndex iEntryBegin = rRowExtents[iRow];
+        const TIndex iEntryEnd = rRowExtents[iRow + 1];
+
+        if (this->isConstrained(iRow)) {
+            bool hasDiagonal = false;
+            for (TIndex iEntry=iEntryBegin; iEntry<iEntryEnd; ++iEntry) {
+                const bool isDiagonal = static_cast<std::size_t>(rColumnIndices[iEntry]) == iRow;
+                rNonzeros[iEntry] = isDiagonal ? static_cast<TValue>(1) : static_cast<TValue>(0);
+                hasDiagonal |= isDiagonal;
+            }
+            if (!hasDiagonal) missingDiagonal.store(true, std::memory_order_relaxed);
+            pRhs[iRow] = _values[iRow];
+        } else if (eliminateColumns) {
+            TValue correction = static_cast<TValue>(0);
+            for (TIndex iEntry=iEntryBegin; iEntry<iEntryEnd; ++iEntry) {
+                const std::size_t iColumn = rColumnIndices[iEntry];
+                if (this->isConstrained(iColumn)) {
+                    correction += rNonzeros[iEntry] * _values[iColumn];
+                    rNonzeros[iEntry] = static_cast<TValue>(0);
+                }
+            }
+            pRhs[iRow] -= correction;
+        }
+    };
+
+    if (!rThreadPool.has_value() || rThreadPool.value().size() < 2) {
+        for (std::size_t iRow=0ul; iRow<rowCount; ++iRow) job(iRow);
+    } else {
+        mp::ParallelFor<>(rThreadPool.value())(rowCount, job);
+    }
+
+    CIE_CHECK(!missingDiagonal.load(), "constrained rows must have a diagonal entry")
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+} // namespace cie::fem
+
+
+#endif
@@ -9,6 +9,9 @@
 #include "packages/maths/inc/power.hpp"
 #include "packages/macros/inc/checks.hpp"
 
+// --- External Includes ---
+#include "Eigen/Dense"
+
 // --- STL Includes ---
 #include <algorithm>
 
@@ -42,18 +45,52 @@ inline void Quadrature<TValue,Dimension>::evaluate(Ref<const TExpression> rExpre
               0);
 
     // Evaluate expression at quadrature points
-    for (const auto& rItem : this->_nodesAndWeights) {
+    const unsigned pointCount = this->pointCount();
+    for (unsigned iPoint=0; iPoint<pointCount; ++iPoint) {
         // Evaluate expression into a buffer
-        rExpression.evaluate(rItem.data(),
-                              rItem.data() + Dimension,
-                              itBufferBegin);
+        const auto itPoint = this->_points.data() + iPoint * Dimension;
+        rExpression.evaluate(itPoint,
+                             itPoint + Dimension,
+                             itBufferBegin);
 
         // Increment output with scaled buffer items
-        const auto weight = rItem.back();
+        const auto weight = this->_weights[iPoint];
         for (unsigned iOut=0; iOut<size; ++iOut) {
             itOut[iOut] += weight * itBufferBegin[iOut];
         }
-    } // for item in nodesAndWeights
+    } // for iPoint in range(pointCount)
+}
+
+
+template <concepts::Numeric TValue, unsigned Dimension>
+template <maths::Expression TExpression>
+inline void Quadrature<TValue,Dimension>::evaluateBlock(Ref<const TExpression> rExpression,
+                                                        typename TExpression::Iterator itBlockBegin,
+                                                        typename TExpression::Iterator itOut) const
+{
+    const unsigned size = rExpression.size();
+    const unsigned pointCount = this->pointCount();
+
+    // Evaluate the expression at all quadrature points into a (pointCount x size) block
+    if constexpr (requires {rExpression.evaluateBatch(this->_points.data(), pointCount, itBlockBegin, maths::BatchLayout::PointMajor);}) {
+        rExpression.evaluateBatch(this->_points.data(), pointCount, itBlockBegin, maths::BatchLayout::PointMajor);
+    } else {
+        for (unsigned iPoint=0; iPoint<pointCount; ++iPoint) {
+            const auto itPoint = this->_points.data() + iPoint * Dimension;
+            rExpression.evaluate(itPoint,
+                                 itPoint + Dimension,
+                                 itBlockBegin + iPoint * size);
+        } // for iPoint in range(pointCount)
+    }
+
+    // Reduce the block with the weights: out = block^T * weights.
+    // The point-major block is the column-major (size x pointCount) matrix.
+    using Value = typename TExpression::Value;
+    using BlockAdaptor = Eigen::Map<const Eigen::Matrix<Value,Eigen::Dynamic,Eigen::Dynamic,Eigen::ColMajor>>;
+    using VectorAdaptor = Eigen::Map<Eigen::Matrix<Value,Eigen::Dynamic,1>>;
+    using ConstVectorAdaptor = Eigen::Map<const Eigen::Matrix<Value,Eigen::Dynamic,1>>;
+    VectorAdaptor(&*itOut, size).noalias() = BlockAdaptor(&*itBlockBegin, size, pointCount)
+                                           * ConstVectorAdaptor(this->_weights.data(), pointCount);
 }
 
 
@@ -61,9 +98,9 @@ template <concepts::Numeric TValue, unsigned Dimension>
 template <class TOutputIt>
 void Quadrature<TValue,Dimension>::getIntegrationPoints(TOutputIt itOutput) const
 {
-    for (const auto& rItem : _nodesAndWeights) {
+    for (auto itPoint=_points.begin(); itPoint!=_points.end(); itPoint+=Dimension) {
         typename Quadrature::Point point;
-        memcpy(point.data(), rItem.data(), Dimension);
+        std::copy(itPoint, itPoint + Dimension, point.data());
         *itOutput++ = std::move(point);
     }
 }
@@ -73,9 +110,7 @@ template <concepts::Numeric TValue, unsigned Dimension>
 template <class TOutputIt>
 void Quadrature<TValue,Dimension>::getIntegrationWeights(TOutputIt itOutput) const
 {
-    for (const auto& rItem : _nodesAndWeights) {
-        *itOutput++ = rItem.back();
-    }
+    std::copy(_weights.begin(), _weights.end(), itOutput);
 }
 
 
@@ -0,0 +1,286 @@
+#ifndef CIE_FEM_NUMERIC_SUM_FACTORIZATION_IMPL_HPP
+#define CIE_FEM_NUMERIC_SUM_FACTORIZATION_IMPL_HPP
+
+// --- FEM Includes ---
+#include "packages/numeric/inc/SumFactorization.hpp"
+#include "packages/maths/inc/OuterProduct.hpp"
+
+// --- Utility Includes ---
+#include "packages/macros/inc/exceptions.hpp"
+#include "packages/macros/inc/checks.hpp"
+#include "packages/maths/inc/power.hpp"
+
+// --- STL Includes ---
+#include <algorithm> // fill
+#include <cmath> // abs
+
+
+namespace cie::fem {
+
+
+template <class TAnsatzSpace>
+SumFactorization<TAnsatzSpace>::SumFactorization(Ref<const TAnsatzSpace> rAnsatzSpace,
+                                                 Ref<const QuadratureBase<Value>> rQuadrature)
+    : _setSize(rAnsatzSpace.ansatzSet().size()),
+      _mass(_setSize * _setSize, static_cast<Value>(0)),
+      _stiffness(_setSize * _setSize, static_cast<Value>(0))
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const auto& rNodes = rQuadrature.nodes();
+    const auto& rWeights = rQuadrature.weights();
+    CIE_CHECK(rNodes.size() == rWeights.size(), "Inconsistent quadrature")
+
+    // Tabulate scalar basis functions and their derivatives at the nodes
+    const unsigned nodeCount = rNodes.size();
+    DynamicArray<Value> values(nodeCount * _setSize), derivatives(nodeCount * _setSize);
+    {
+        unsigned iFunction = 0u;
+        for (const auto& rScalarExpression : rAnsatzSpace.ansatzSet()) {
+            const auto derivative = rScalarExpression.makeDerivative();
+            for (unsigned iNode=0u; iNode<nodeCount; ++iNode) {
+                const auto itNode = rNodes.data() + iNode;
+                rScalarExpression.evaluate(itNode, itNode + 1, values.data() + iNode * _setSize + iFunction);
+                derivative.evaluate(itNode, itNode + 1, derivatives.data() + iNode * _setSize + iFunction);
+            }
+            ++iFunction;
+        } // for rScalarExpression in ansatzSet
+    }
+
+    for (unsigned iNode=0u; iNode<nodeCount; ++iNode) {
+        const Ptr<const Value> pValues = values.data() + iNode * _setSize;
+        const Ptr<const Value> pDerivatives = derivatives.data() + iNode * _setSize;
+        const Value weight = rWeights[iNode];
+        for (unsigned iRow=0u; iRow<_setSize; ++iRow) {
+            for (unsigned iColumn=0u; iColumn<_setSize; ++iColumn) {
+                _mass[iRow * _setSize + iColumn] += weight * pValues[iRow] * pValues[iColumn];
+                _stiffness[iRow * _setSize + iColumn] += weight * pDerivatives[iRow] * pDerivatives[iColumn];
+            }
+        }
+    } // for iNode in range(nodeCount)
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TAnsatzSpace>
+template <maths::SpatialTransform TTransform>
+void SumFactorization<TAnsatzSpace>::computeMass(Ref<const TTransform> rTransform,
+                                                 Value density,
+                                                 Iterator itOut) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const auto scales = SumFactorization::getScales(rTransform);
+    Value scale = density;
+    for (const Value axisScale : scales) scale *= std::abs(axisScale);
+
+    StaticArray<unsigned,Dimension> rowIndices, columnIndices;
+    std::fill(rowIndices.begin(), rowIndices.end(), 0u);
+    do {
+        std::fill(columnIndices.begin(), columnIndices.end(), 0u);
+        do {
+            Value entry = scale;
+            for (unsigned iAxis=0u; iAxis<Dimension; ++iAxis) {
+                entry *= _mass[rowIndices[iAxis] * _setSize + columnIndices[iAxis]];
+            }
+            *itOut++ = entry;
+        } while (maths::OuterProduct<Dimension>::next(_setSize, columnIndices.data()));
+    } while (maths::OuterProduct<Dimension>::next(_setSize, rowIndices.data()));
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TAnsatzSpace>
+template <maths::SpatialTransform TTransform>
+void SumFactorization<TAnsatzSpace>::computeStiffness(Ref<const TTransform> rTransform,
+                                                      Value modulus,
+                                                      Iterator itOut) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const auto scales = SumFactorization::getScales(rTransform);
+    Value determinant = static_cast<Value>(1);
+    for (const Value axisScale : scales) determinant *= std::abs(axisScale);
+
+    StaticArray<Value,Dimension> axisCoefficients;
+    for (unsigned iAxis=0u; iAxis<Dimension; ++iAxis) {
+        axisCoefficients[iAxis] = modulus * determinant / (scales[iAxis] * scales[iAxis]);
+    }
+
+    StaticArray<unsigned,Dimension> rowIndices, columnIndices;
+    StaticArray<Value,Dimension> masses, stiffnesses;
+    std::fill(rowIndices.begin(), rowIndices.end(), 0u);
+    do {
+        std::fill(columnIndices.begin(), columnIndices.end(), 0u);
+        do {
+            for (unsigned iAxis=0u; iAxis<Dimension; ++iAxis) {
+                const unsigned iEntry = rowIndices[iAxis] * _setSize + columnIndices[iAxis];
+                masses[iAxis] = _mass[iEntry];
+                stiffnesses[iAxis] = _stiffness[iEntry];
+            }
+
+            // Sum the Kronecker products, with the product of preceding
+            // masses carried forward and the following ones recomputed.
+            Value entry = static_cast<Value>(0);
+            Value leadingMass = static_cast<Value>(1);
+            for (unsigned iDerivative=0u; iDerivative<Dimension; ++iDerivative) {
+                Value term = axisCoefficients[iDerivative] * leadingMass * stiffnesses[iDerivative];
+                for (unsigned iAxis=iDerivative+1; iAxis<Dimension; ++iAxis) term *= masses[iAxis];
+                entry += term;
+                leadingMass *= masses[iDerivative];
+            }
+            *itOut++ = entry;
+        } while (maths::OuterProduct<Dimension>::next(_setSize, columnIndices.data()));
+    } while (maths::OuterProduct<Dimension>::next(_setSize, rowIndices.data()));
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TAnsatzSpace>
+template <maths::SpatialTransform TTransform>
+void SumFactorization<TAnsatzSpace>::applyMass(Ref<const TTransform> rTransform,
+                                               Value density,
+                                               ConstIterator itInput,
+                                               Iterator itOut,
+                                               std::span<Value> buffer) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const auto scales = SumFactorization::getScales(rTransform);
+    Value scale = density;
+    for (const Value axisScale : scales) scale *= std::abs(axisScale);
+
+    StaticArray<Ptr<const Value>,Dimension> factors;
+    std::fill(factors.begin(), factors.end(), _mass.data());
+    const Ptr<const Value> pProduct = this->applyKronecker(factors, itInput, buffer);
+
+    const unsigned size = this->size();
+    for (unsigned iComponent=0u; iComponent<size; ++iComponent) itOut[iComponent] = scale * pProduct[iComponent];
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TAnsatzSpace>
+template <maths::SpatialTransform TTransform>
+void SumFactorization<TAnsatzSpace>::applyStiffness(Ref<const TTransform> rTransform,
+                                                    Value modulus,
+                                                    ConstIterator itInput,
+                                                    Iterator itOut,
+                                                    std::span<Value> buffer) const
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const auto scales = SumFactorization::getScales(rTransform);
+    Value determinant = static_cast<Value>(1);
+    for (const Value axisScale : scales) determinant *= std::abs(axisScale);
+
+    const unsigned size = this->size();
+    std::fill(itOut, itOut + size, static_cast<Value>(0));
+
+    StaticArray<Ptr<const Value>,Dimension> factors;
+    for (unsigned iDerivative=0u; iDerivative<Dimension; ++iDerivative) {
+        std::fill(factors.begin(), factors.end(), _mass.data());
+        factors[iDerivative] = _stiffness.data();
+        const Ptr<const Value> pProduct = this->applyKronecker(factors, itInput, buffer);
+
+        const Value coefficient = modulus * determinant / (scales[iDerivative] * scales[iDerivative]);
+        for (unsigned iComponent=0u; iComponent<size; ++iComponent) itOut[iComponent] += coefficient * pProduct[iComponent];
+    } // for iDerivative in range(Dimension)
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TAnsatzSpace>
+unsigned SumFactorization<TAnsatzSpace>::size() const noexcept
+{
+    return intPow(_setSize, Dimension);
+}
+
+
+template <class TAnsatzSpace>
+unsigned SumFactorization<TAnsatzSpace>::setSize() const noexcept
+{
+    return _setSize;
+}
+
+
+template <class TAnsatzSpace>
+unsigned SumFactorization<TAnsatzSpace>::getMinBufferSize() const noexcept
+{
+    return 2u * this->size();
+}
+
+
+template <class TAnsatzSpace>
+template <maths::SpatialTransform TTransform>
+StaticArray<typename SumFactorization<TAnsatzSpace>::Value,SumFactorization<TAnsatzSpace>::Dimension>
+SumFactorization<TAnsatzSpace>::getScales(Ref<const TTransform> rTransform)
+{
+    // The transform is affine, so the images of the unit vectors
+    // relative to the image of the origin are its columns.
+    StaticArray<Value,Dimension> point, origin, image, scales;
+    std::fill(point.begin(), point.end(), static_cast<Value>(0));
+    rTransform.evaluate(point.data(), point.data() + Dimension, origin.data());
+
+    for (unsigned iAxis=0u; iAxis<Dimension; ++iAxis) {
+        point[iAxis] = static_cast<Value>(1);
+        rTransform.evaluate(point.data(), point.data() + Dimension, image.data());
+        point[iAxis] = static_cast<Value>(0);
+
+        scales[iAxis] = image[iAxis] - origin[iAxis];
+        for (unsigned iComponent=0u; iComponent<Dimension; ++iComponent) {
+            CIE_CHECK(iComponent == iAxis || image[iComponent] == origin[iComponent],
+                      "Sum factorization requires an axis-aligned transform")
+        }
+    } // for iAxis in range(Dimension)
+
+    return scales;
+}
+
+
+template <class TAnsatzSpace>
+Ptr<const typename SumFactorization<TAnsatzSpace>::Value>
+SumFactorization<TAnsatzSpace>::applyKronecker(Ref<const StaticArray<Ptr<const Value>,Dimension>> rFactors,
+                                               ConstIterator itInput,
+                                               std::span<Value> buffer) const
+{
+    const unsigned size = this->size();
+    CIE_OUT_OF_RANGE_CHECK(this->getMinBufferSize() <= buffer.size())
+
+    Ptr<const Value> pSource = itInput;
+    unsigned stride = 1u;
+    for (unsigned iAxis=0u; iAxis<Dimension; ++iAxis) {
+        const Ptr<Value> pTarget = buffer.data() + (iAxis % 2u) * size;
+        const Ptr<const Value> pFactor = rFactors[iAxis];
+        const unsigned blockSize = stride * _setSize;
+
+        // Contract the axis' index with the 1D matrix, for every combination of the other indices
+        for (unsigned iBlock=0u; iBlock<size; iBlock+=blockSize) {
+            for (unsigned iRow=0u; iRow<_setSize; ++iRow) {
+                const Ptr<Value> pRow = pTarget + iBlock + iRow * stride;
+                std::fill(pRow, pRow + stride, static_cast<Value>(0));
+                for (unsigned iColumn=0u; iColumn<_setSize; ++iColumn) {
+                    const Value factor = pFactor[iRow * _setSize + iColumn];
+                    const Ptr<const Value> pColumn = pSource + iBlock + iColumn * stride;
+                    for (unsigned iInner=0u; iInner<stride; ++iInner) pRow[iInner] += factor * pColumn[iInner];
+                }
+            } // for iRow in range(setSize)
+        } // for iBlock in range(0, size, blockSize)
+
+        pSource = pTarget;
+        stride = blockSize;
+    } // for iAxis in range(Dimension)
+
+    return pSource;
+}
+
+
+} // namespace cie::fem
+
+
+#endif
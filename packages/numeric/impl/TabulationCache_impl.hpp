@@ -0,0 +1,178 @@
+#ifndef CIE_FEM_NUMERIC_TABULATION_CACHE_IMPL_HPP
+#define CIE_FEM_NUMERIC_TABULATION_CACHE_IMPL_HPP
+
+// --- FEM Includes ---
+#include "packages/numeric/inc/TabulationCache.hpp"
+#include "packages/maths/inc/AnsatzSpace.hpp"
+
+// --- Utility Includes ---
+#include "packages/macros/inc/exceptions.hpp"
+#include "packages/macros/inc/checks.hpp"
+
+// --- STL Includes ---
+#include <algorithm> // equal
+#include <functional> // hash
+
+
+namespace cie::fem {
+
+
+template <class TAnsatzSpace>
+AnsatzTabulation<TAnsatzSpace>::AnsatzTabulation(Ref<const TAnsatzSpace> rAnsatzSpace,
+                                                 Ref<const QuadratureType> rQuadrature)
+    : _ansatzCount(rAnsatzSpace.size()),
+      _points(),
+      _weights(),
+      _values(),
+      _derivatives()
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    _points.assign(rQuadrature.points().begin(), rQuadrature.points().end());
+    _weights.assign(rQuadrature.weights().begin(), rQuadrature.weights().end());
+    CIE_CHECK(_points.size() == _weights.size() * Dimension, "Inconsistent quadrature")
+
+    const unsigned pointCount = this->pointCount();
+    const auto derivatives = rAnsatzSpace.makeDerivative();
+    _values.resize(pointCount * _ansatzCount);
+    _derivatives.resize(pointCount * derivatives.size());
+    rAnsatzSpace.evaluateBatch(_points.data(), pointCount, _values.data(), maths::BatchLayout::PointMajor);
+    derivatives.evaluateBatch(_points.data(), pointCount, _derivatives.data(), maths::BatchLayout::PointMajor);
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TAnsatzSpace>
+unsigned AnsatzTabulation<TAnsatzSpace>::pointCount() const noexcept
+{
+    return _weights.size();
+}
+
+
+template <class TAnsatzSpace>
+unsigned AnsatzTabulation<TAnsatzSpace>::ansatzCount() const noexcept
+{
+    return _ansatzCount;
+}
+
+
+template <class TAnsatzSpace>
+std::span<const typename AnsatzTabulation<TAnsatzSpace>::Value,AnsatzTabulation<TAnsatzSpace>::Dimension>
+AnsatzTabulation<TAnsatzSpace>::getPoint(unsigned iPoint) const
+{
+    CIE_OUT_OF_RANGE_CHECK(iPoint < this->pointCount())
+    return std::span<const Value,Dimension>(_points.data() + iPoint * Dimension, Dimension);
+}
+
+
+template <class TAnsatzSpace>
+typename AnsatzTabulation<TAnsatzSpace>::Value
+AnsatzTabulation<TAnsatzSpace>::getWeight(unsigned iPoint) const
+{
+    CIE_OUT_OF_RANGE_CHECK(iPoint < this->pointCount())
+    return _weights[iPoint];
+}
+
+
+template <class TAnsatzSpace>
+std::span<const typename AnsatzTabulation<TAnsatzSpace>::Value>
+AnsatzTabulation<TAnsatzSpace>::getValues(unsigned iPoint) const
+{
+    CIE_OUT_OF_RANGE_CHECK(iPoint < this->pointCount())
+    return std::span<const Value>(_values.data() + iPoint * _ansatzCount, _ansatzCount);
+}
+
+
+template <class TAnsatzSpace>
+std::span<const typename AnsatzTabulation<TAnsatzSpace>::Value>
+AnsatzTabulation<TAnsatzSpace>::getDerivatives(unsigned iPoint) const
+{
+    CIE_OUT_OF_RANGE_CHECK(iPoint < this->pointCount())
+    const std::size_t derivativeSize = Dimension * _ansatzCount;
+    return std::span<const Value>(_derivatives.data() + iPoint * derivativeSize, derivativeSize);
+}
+
+
+template <class TAnsatzSpace>
+std::shared_ptr<const typename TabulationCache<TAnsatzSpace>::Tabulation>
+TabulationCache<TAnsatzSpace>::get(Ref<const TAnsatzSpace> rAnsatzSpace,
+                                   Ref<const typename Tabulation::QuadratureType> rQuadrature)
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    const auto pAnsatzSet = rAnsatzSpace.sharedAnsatzSet();
+    const Key key(pAnsatzSet.get(), TabulationCache::hash(rQuadrature));
+
+    std::scoped_lock<std::mutex> lock(_mutex);
+    const auto [itBegin, itEnd] = _tabulations.equal_range(key);
+    for (auto it=itBegin; it!=itEnd; ++it) {
+        // A live entry with the same address must belong to the same scalar basis
+        if (!it->second.pAnsatzSet.expired() && TabulationCache::matches(*it->second.pTabulation, rQuadrature)) {
+            return it->second.pTabulation;
+        }
+    }
+
+    // Discard the tabulations of destroyed ansatz spaces before adding a new one
+    std::erase_if(_tabulations, [](const auto& rItem) {return rItem.second.pAnsatzSet.expired();});
+
+    auto pTabulation = std::make_shared<const Tabulation>(rAnsatzSpace, rQuadrature);
+    _tabulations.emplace(key, Entry {pAnsatzSet, pTabulation});
+    return pTabulation;
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TAnsatzSpace>
+std::size_t TabulationCache<TAnsatzSpace>::hash(Ref<const typename Tabulation::QuadratureType> rQuadrature) noexcept
+{
+    using Value = typename Tabulation::Value;
+    std::size_t output = rQuadrature.pointCount();
+    const auto combine = [&output](Value value) {
+        output ^= std::hash<Value>()(value) + 0x9e3779b97f4a7c15ul + (output << 6) + (output >> 2);
+    };
+    for (const Value coordinate : rQuadrature.points()) combine(coordinate);
+    for (const Value weight : rQuadrature.weights()) combine(weight);
+    return output;
+}
+
+
+template <class TAnsatzSpace>
+bool TabulationCache<TAnsatzSpace>::matches(Ref<const Tabulation> rTabulation,
+                                            Ref<const typename Tabulation::QuadratureType> rQuadrature) noexcept
+{
+    const auto points = rQuadrature.points();
+    const auto weights = rQuadrature.weights();
+    if (rTabulation.pointCount() != weights.size()) return false;
+
+    for (unsigned iPoint=0u; iPoint<rTabulation.pointCount(); ++iPoint) {
+        if (rTabulation.getWeight(iPoint) != weights[iPoint]) return false;
+        const auto point = rTabulation.getPoint(iPoint);
+        if (!std::equal(point.begin(), point.end(), points.begin() + iPoint * Tabulation::Dimension)) return false;
+    }
+
+    return true;
+}
+
+
+template <class TAnsatzSpace>
+std::size_t TabulationCache<TAnsatzSpace>::size() const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    return _tabulations.size();
+}
+
+
+template <class TAnsatzSpace>
+void TabulationCache<TAnsatzSpace>::clear()
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    _tabulations.clear();
+}
+
+
+} // namespace cie::fem
+
+
+#endif
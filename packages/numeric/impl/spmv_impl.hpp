@@ -0,0 +1,210 @@
+#ifndef CIE_FEM_NUMERIC_SPMV_IMPL_HPP
+#define CIE_FEM_NUMERIC_SPMV_IMPL_HPP
+
+// --- FEM Includes ---
+#include "packages/numeric/inc/spmv.hpp"
+
+// --- Utility Includes ---
+#include "packages/macros/inc/exceptions.hpp"
+#include "packages/macros/inc/checks.hpp"
+#include "packages/concurrency/inc/ParallelFor.hpp"
+
+// --- STL Includes ---
+#include <algorithm> // min, max, fill
+
+
+namespace cie::fem {
+
+
+template <class TIndex, class TValue>
+void spmv(Ref<const DynamicArray<TIndex>> rRowExtents,
+          Ref<const DynamicArray<TIndex>> rColumnIndices,
+          Ref<const DynamicArray<TValue>> rNonzeros,
+          Ptr<const TValue> pInput,
+          Ptr<TValue> pOutput,
+          OptionalRef<mp::ThreadPoolBase> rThreadPool)
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    if (rRowExtents.empty()) return;
+    const std::size_t rowCount = rRowExtents.size() - 1;
+    CIE_OUT_OF_RANGE_CHECK(rColumnIndices.size() == rNonzeros.size())
+
+    const auto job = [&rRowExtents, &rColumnIndices, &rNonzeros, pInput, pOutput](std::size_t iRow) -> void {
+        TValue product = static_cast<TValue>(0);
+        for (TIndex iEntry=rRowExtents[iRow]; iEntry<rRowExtents[iRow + 1]; ++iEntry) {
+            product += rNonzeros[iEntry] * pInput[rColumnIndices[iEntry]];
+        }
+        pOutput[iRow] = product;
+    };
+
+    if (!rThreadPool.has_value() || rThreadPool.value().size() < 2) {
+        for (std::size_t iRow=0ul; iRow<rowCount; ++iRow) job(iRow);
+    } else {
+        mp::ParallelFor<>(rThreadPool.value())(rowCount, job);
+    }
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TIndex, class TValue>
+void symmetricSpmv(Ref<const DynamicArray<TIndex>> rRowExtents,
+                   Ref<const DynamicArray<TIndex>> rColumnIndices,
+                   Ref<const DynamicArray<TValue>> rNonzeros,
+                   Ptr<const TValue> pInput,
+                   Ptr<TValue> pOutput,
+                   OptionalRef<mp::ThreadPoolBase> rThreadPool)
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+    DynamicArray<TValue> buffer;
+    symmetricSpmv(rRowExtents, rColumnIndices, rNonzeros, pInput, pOutput, buffer, rThreadPool);
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TIndex, class TValue>
+void symmetricSpmv(Ref<const DynamicArray<TIndex>> rRowExtents,
+                   Ref<const DynamicArray<TIndex>> rColumnIndices,
+                   Ref<const DynamicArray<TValue>> rNonzeros,
+                   Ptr<const TValue> pInput,
+                   Ptr<TValue> pOutput,
+                   Ref<DynamicArray<TValue>> rBuffer,
+                   OptionalRef<mp::ThreadPoolBase> rThreadPool)
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    if (rRowExtents.empty()) return;
+    const std::size_t rowCount = rRowExtents.size() - 1;
+    CIE_OUT_OF_RANGE_CHECK(rColumnIndices.size() == rNonzeros.size())
+
+    // Multiply rows [iBegin, iEnd) of the upper triangle and its transpose.
+    // Row products and transposed contributions to rows before iEnd are added to the output,
+    // transposed contributions to the rest are added to the accumulator of rows [iEnd, iReach).
+    const auto multiplyRows = [&rRowExtents, &rColumnIndices, &rNonzeros, pInput, pOutput](std::size_t iBegin,
+                                                                                           std::size_t iEnd,
+                                                                                           [[maybe_unused]] std::size_t iReach,
+                                                                                           Ptr<TValue> pAccumulator) -> void {
+        for (std::size_t iRow=iBegin; iRow<iEnd; ++iRow) {
+            const TValue input = pInput[iRow];
+            TValue product = static_cast<TValue>(0);
+            for (TIndex iEntry=rRowExtents[iRow]; iEntry<rRowExtents[iRow + 1]; ++iEntry) {
+                const std::size_t iColumn = static_cast<std::size_t>(rColumnIndices[iEntry]);
+                const TValue nonzero = rNonzeros[iEntry];
+                product += nonzero * pInput[iColumn];
+                if (iColumn == iRow) continue;
+                else if (iColumn < iEnd) pOutput[iColumn] += nonzero * input;
+                else {
+                    CIE_OUT_OF_RANGE_CHECK(iColumn < iReach)
+                    pAccumulator[iColumn - iEnd] += nonzero * input;
+                }
+            }
+            pOutput[iRow] += product;
+        } // for iRow in range(iBegin, iEnd)
+    };
+
+    std::fill(pOutput, pOutput + rowCount, static_cast<TValue>(0));
+    const std::size_t threadCount = rThreadPool.has_value() ? std::min(rThreadPool.value().size(), rowCount) : 1ul;
+
+    if (threadCount < 2) {
+        multiplyRows(0ul, rowCount, rowCount, pOutput);
+    } else {
+        // Chunk k covers rows [b_k, b_{k+1}), and its accumulator rows [b_{k+1}, r_k),
+        // where r_k is one past the largest column of the chunk. Columns are sorted
+        // within each row, so r_k is found from the last entry of each row. For banded
+        // matrices, each accumulator is about as long as the bandwidth.
+        const auto getChunkBegin = [rowCount, threadCount](std::size_t iChunk) -> std::size_t {
+            return iChunk * rowCount / threadCount;
+        };
+
+        // Reach r_k of each chunk, followed by the offsets of the accumulators in the buffer.
+        DynamicArray<std::size_t> reaches(threadCount), offsets(threadCount + 1);
+        mp::ParallelFor<>(rThreadPool.value())(threadCount, [&](std::size_t iChunk) -> void {
+            const std::size_t iEnd = getChunkBegin(iChunk + 1);
+            std::size_t iReach = iEnd;
+            for (std::size_t iRow=getChunkBegin(iChunk); iRow<iEnd; ++iRow) {
+                if (rRowExtents[iRow] < rRowExtents[iRow + 1]) {
+                    iReach = std::max(iReach, static_cast<std::size_t>(rColumnIndices[rRowExtents[iRow + 1] - 1]) + 1);
+                }
+            }
+            reaches[iChunk] = iReach;
+        });
+
+        offsets.front() = 0ul;
+        for (std::size_t iChunk=0ul; iChunk<threadCount; ++iChunk) {
+            offsets[iChunk + 1] = offsets[iChunk] + reaches[iChunk] - getChunkBegin(iChunk + 1);
+        }
+        if (rBuffer.size() < offsets.back()) rBuffer.resize(offsets.back());
+
+        mp::ParallelFor<>(rThreadPool.value())(threadCount, [&](std::size_t iChunk) -> void {
+            const std::size_t iEnd = getChunkBegin(iChunk + 1);
+            const Ptr<TValue> pAccumulator = rBuffer.data() + offsets[iChunk];
+            std::fill(pAccumulator, pAccumulator + (reaches[iChunk] - iEnd), static_cast<TValue>(0));
+            multiplyRows(getChunkBegin(iChunk), iEnd, reaches[iChunk], pAccumulator);
+        });
+
+        // Each chunk collects the overlaps of earlier chunks' accumulators with its own rows
+        mp::ParallelFor<>(rThreadPool.value())(threadCount, [&](std::size_t iChunk) -> void {
+            const std::size_t iBegin = getChunkBegin(iChunk);
+            const std::size_t iEnd = getChunkBegin(iChunk + 1);
+            for (std::size_t iSource=0ul; iSource<iChunk; ++iSource) {
+                const std::size_t iSourceEnd = getChunkBegin(iSource + 1);
+                const std::size_t iOverlapBegin = std::max(iBegin, iSourceEnd);
+                const std::size_t iOverlapEnd = std::min(iEnd, reaches[iSource]);
+                Ptr<const TValue> pAccumulator = rBuffer.data() + offsets[iSource];
+                for (std::size_t iRow=iOverlapBegin; iRow<iOverlapEnd; ++iRow) pOutput[iRow] += pAccumulator[iRow - iSourceEnd];
+            } // for iSource in range(iChunk)
+        });
+    }
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+template <class TIndex, class TValue>
+void blockSpmv(std::size_t blockSize,
+               Ref<const DynamicArray<TIndex>> rRowExtents,
+               Ref<const DynamicArray<TIndex>> rColumnIndices,
+               Ref<const DynamicArray<TValue>> rNonzeros,
+               Ptr<const TValue> pInput,
+               Ptr<TValue> pOutput,
+               OptionalRef<mp::ThreadPoolBase> rThreadPool)
+{
+    CIE_BEGIN_EXCEPTION_TRACING
+
+    if (rRowExtents.empty()) return;
+    const std::size_t rowCount = rRowExtents.size() - 1;
+    const std::size_t blockEntryCount = blockSize * blockSize;
+    CIE_OUT_OF_RANGE_CHECK(rColumnIndices.size() * blockEntryCount == rNonzeros.size())
+
+    const auto job = [&rRowExtents, &rColumnIndices, &rNonzeros, pInput, pOutput, blockSize, blockEntryCount](std::size_t iRow) -> void {
+        const Ptr<TValue> pRowOutput = pOutput + iRow * blockSize;
+        std::fill(pRowOutput, pRowOutput + blockSize, static_cast<TValue>(0));
+
+        for (TIndex iBlock=rRowExtents[iRow]; iBlock<rRowExtents[iRow + 1]; ++iBlock) {
+            Ptr<const TValue> pEntry = rNonzeros.data() + iBlock * blockEntryCount;
+            const Ptr<const TValue> pColumnInput = pInput + rColumnIndices[iBlock] * blockSize;
+            for (std::size_t iComponent=0ul; iComponent<blockSize; ++iComponent) {
+                TValue product = static_cast<TValue>(0);
+                for (std::size_t jComponent=0ul; jComponent<blockSize; ++jComponent) {
+                    product += *pEntry++ * pColumnInput[jComponent];
+                }
+                pRowOutput[iComponent] += product;
+            }
+        } // for iBlock in range(rRowExtents[iRow], rRowExtents[iRow + 1])
+    };
+
+    if (!rThreadPool.has_value() || rThreadPool.value().size() < 2) {
+        for (std::size_t iRow=0ul; iRow<rowCount; ++iRow) job(iRow);
+    } else {
+        mp::ParallelFor<>(rThreadPool.value())(rowCount, job);
+    }
+
+    CIE_END_EXCEPTION_TRACING
+}
+
+
+} // namespace cie::fem
+
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef CIE_FEM_NUMERIC_DIRICHLET_CONSTRAINTS_HPP
+#define CIE_FEM_NUMERIC_DIRICHLET_CONSTRAINTS_HPP
+
+// --- Utility Includes ---
+#include "packages/stl_extension/inc/DynamicArray.hpp"
+#include "packages/stl_extension/inc/OptionalRef.hpp"
+#include "packages/concurrency/inc/ThreadPoolBase.hpp"
+#include "packages/types/inc/types.hpp"
+
+// --- STL Includes ---
+#include <cstdint> // uint64_t
+#include <cstddef> // size_t
+
+
+namespace cie::fem {
+
+
+/// @brief Ways of imposing Dirichlet conditions on a linear system.
+enum class ConstraintImposition
+{
+    /// @brief Replace constrained rows with identity rows, and move the contributions of
+    ///        constrained columns to the right hand side. Preserves the symmetry of the matrix.
+    SymmetricElimination,
+    /// @brief Only replace constrained rows with identity rows. Cheaper, but the resulting
+    ///        matrix is no longer symmetric.
+    RowReplacement
+}; // enum class ConstraintImposition
+
+
+/// @brief Set of Dirichlet conditions prescribing the values of individual DoFs.
+/// @details Constrained DoFs are marked in a bitmap, which allows imposing all conditions
+///          on a CSR system in a single sweep over its nonzeros, regardless of the number
+///          of constraints. Each row is modified independently, so the sweep is distributed
+///          row-wise if a thread pool is provided.
+/// @tparam TValue Scalar type of the linear system.
+template <class TValue>
+class DirichletConstraints
+{
+public:
+    using Value = TValue;
+
+public:
+    DirichletConstraints() noexcept;
+
+    /// @param dofCount Number of DoFs in the system, constrained or not.
+    explicit DirichletConstraints(std::size_t dofCount);
+
+    /// @brief Prescribe the value of a DoF, overwriting its previous value if it was already constrained.
+    void addConstraint(std::size_t iDoF, TValue value);
+
+    /// @brief Check whether a DoF is constrained.
+    bool isConstrained(std::size_t iDoF) const noexcept;
+
+    /// @brief Prescribed value of a constrained DoF.
+    TValue getValue(std::size_t iDoF) const;
+
+    /// @brief Number of constrained DoFs.
+    std::size_t size() const noexcept;
+
+    /// @brief Number of DoFs in the system, constrained or not.
+    std::size_t dofCount() const noexcept;
+
+    /// @brief Impose the constraints on a linear system stored in CSR format.
+    /// @param rRowExtents Row extents of the matrix.
+    /// @param rColumnIndices Column indices of the matrix.
+    /// @param rNonzeros Nonzeros of the matrix. Constrained rows are overwritten with identity rows.
+    /// @param pRhs Right hand side with @ref dofCount components.
+    /// @param imposition Whether constrained columns are eliminated as well (see @ref ConstraintImposition).
+    /// @param rThreadPool Optional thread pool to distribute rows on.
+    /// @details The matrix must contain all its nonzeros (not only a triangle), and constrained rows
+    ///          must have a diagonal entry.
+    template <class TIndex>
+    void apply(Ref<const DynamicArray<TIndex>> rRowExtents,
+               Ref<const DynamicArray<TIndex>> rColumnIndices,
+               Ref<DynamicArray<TValue>> rNonzeros,
+               Ptr<TValue> pRhs,
+               ConstraintImposition imposition = ConstraintImposition::SymmetricElimination,
+               OptionalRef<mp::ThreadPoolBase> rThreadPool = {}) const;
+
+private:
+    using Word = std::uint64_t;
+
+    static constexpr std::size_t _wordSize = 8 * sizeof(Word);
+
+    /// @brief Bit @a i is set if DoF @a i is constrained.
+    DynamicArray<Word> _mask;
+
+    /// @brief Prescribed value of each DoF, zero if unconstrained.
+    DynamicArray<TValue> _values;
+
+    std::size_t _constraintCount;
+}; // class DirichletConstraints
+
+
+} // namespace cie::fem
+
+#include "packages/numeric/impl/DirichletConstraints_impl.hpp"
+
+#endif
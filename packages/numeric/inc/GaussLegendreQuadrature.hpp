@@ -7,9 +7,6 @@
 // --- FEM Includes ---
 #include "packages/numeric/inc/QuadratureBase.hpp"
 
-// --- STL Includes ---
-#include <limits>
-
 
 namespace cie::fem {
 
@@ -28,9 +25,18 @@ public:
 public:
     GaussLegendreQuadrature() noexcept = default;
 
+    /// @brief Get the rule with the provided number of nodes from a process-wide cache.
+    /// @details The rule is computed on first request (for any thread), and copied afterwards.
+    GaussLegendreQuadrature(Size integrationOrder);
+
+    /// @brief Compute the rule with the provided number of nodes, bypassing the cache.
+    /// @details Nodes are found by Newton iterations on the three-term Legendre recurrence,
+    ///          which costs @f$ \mathcal{O}(n) @f$ per iteration and node, and allocates nothing.
+    /// @param integrationOrder Number of nodes.
+    /// @param comparison Tolerance on the Newton updates of the nodes.
+    /// @param maxNewtonIterations Maximum number of Newton iterations per node.
     GaussLegendreQuadrature(Size integrationOrder,
-                            utils::Comparison<NT> comparison = {0x100 * std::numeric_limits<NT>::epsilon(),
-                                                                0x100 * std::numeric_limits<NT>::epsilon()},
+                            utils::Comparison<NT> comparison,
                             Size maxNewtonIterations = 50ul);
 }; // class GaussLegendreQuadrature
 
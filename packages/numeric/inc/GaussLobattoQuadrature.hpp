@@ -0,0 +1,58 @@
+#ifndef CIE_FEM_NUMERIC_GAUSS_LOBATTO_QUADRATURE_HPP
+#define CIE_FEM_NUMERIC_GAUSS_LOBATTO_QUADRATURE_HPP
+
+// --- Utility Includes ---
+#include "packages/maths/inc/Comparison.hpp"
+
+// --- FEM Includes ---
+#include "packages/numeric/inc/QuadratureBase.hpp"
+
+// --- STL Includes ---
+#include <limits>
+
+
+namespace cie::fem {
+
+
+///@addtogroup fem
+///@{
+
+/** @brief Gauss-Lobatto-Legendre quadrature on [-1, 1].
+ *  @details The rule of @a n nodes includes both endpoints, and the roots of @f$ P_{n-1}' @f$ in between.
+ *           It integrates polynomials up to degree @f$ 2n-3 @f$ exactly, which is one degree less than
+ *           @ref GaussLegendreQuadrature with the same number of nodes.
+ *
+ *           Its main use is collocation: a @ref maths::LagrangePolynomial "Lagrange basis" on the same
+ *           nodes vanishes at all but one integration point, so the mass matrix integrated with this
+ *           rule is diagonal, and its entries are the (tensor product) weights scaled by the jacobian
+ *           determinant. Such lumped mass matrices are assembled into a vector with
+ *           @ref BasicAssembler::assembleLumped, removing the linear solve from explicit time stepping.
+ */
+template <concepts::Numeric NT>
+class GaussLobattoQuadrature final : public QuadratureBase<NT>
+{
+public:
+    using typename QuadratureBase<NT>::NodeContainer;
+
+    using typename QuadratureBase<NT>::WeightContainer;
+
+public:
+    GaussLobattoQuadrature() noexcept = default;
+
+    /// @brief Compute the rule with the provided number of nodes.
+    /// @details Interior nodes are found by Newton iterations on @f$ (1-x^2) P_{n-1}'(x) @f$,
+    ///          evaluated with the three-term Legendre recurrence.
+    /// @param integrationOrder Number of nodes (at least 2).
+    /// @param comparison Tolerance on the Newton updates of the nodes.
+    /// @param maxNewtonIterations Maximum number of Newton iterations per node.
+    GaussLobattoQuadrature(Size integrationOrder,
+                           utils::Comparison<NT> comparison = {0x100 * std::numeric_limits<NT>::epsilon(),
+                                                               0x100 * std::numeric_limits<NT>::epsilon()},
+                           Size maxNewtonIterations = 50ul);
+}; // class GaussLobattoQuadrature
+
+///@}
+
+} // namespace cie::fem
+
+#endif
@@ -11,10 +11,18 @@
 #include "packages/numeric/inc/QuadratureBase.hpp"
 #include "packages/utilities/inc/kernel.hpp"
 
+// --- STL Includes ---
+#include <span> // span
+
 
 namespace cie::fem {
 
 
+/** @brief Tensor product of a @ref QuadratureBase "1D quadrature rule".
+ *  @details Node coordinates and weights are stored in separate arrays (structure of arrays),
+ *           with the coordinates of each node contiguous, and the first index of the tensor
+ *           product varying fastest.
+ */
 template <concepts::Numeric TValue, unsigned Dimension>
 class Quadrature : public Kernel<Dimension,TValue>
 {
@@ -33,14 +41,42 @@ public:
     void evaluate(Ref<const TExpression> rExpression,
                   typename TExpression::Iterator itOutBegin) const;
 
+    /// @brief Integrate an expression by evaluating it at all nodes at once, then reducing with the weights.
+    /// @param rExpression Expression to integrate.
+    /// @param itBlockBegin Buffer of at least @ref pointCount times @a rExpression.size() components.
+    /// @param itOut Output array of @a rExpression.size() components.
+    /// @details The expression is evaluated into a @ref pointCount by @a rExpression.size() block
+    ///          (see @ref maths::BatchLayout::PointMajor "PointMajor"), in a single call if it provides
+    ///          @a evaluateBatch (eg: @ref maths::AnsatzSpace::evaluateBatch "AnsatzSpace"), or point by
+    ///          point otherwise. The block is then reduced by one matrix-vector product with the weights.
+    ///          Compared to @ref evaluate, which accumulates the weighted values after each evaluation,
+    ///          the reduction streams through contiguous memory and is bound by arithmetic rather than
+    ///          by the latency of the accumulation, at the cost of the larger buffer.
+    template <maths::Expression TExpression>
+    void evaluateBlock(Ref<const TExpression> rExpression,
+                       typename TExpression::Iterator itBlockBegin,
+                       typename TExpression::Iterator itOut) const;
+
     template <class TOutputIt>
     void getIntegrationPoints(TOutputIt itOutput) const;
 
     template <class TOutputIt>
     void getIntegrationWeights(TOutputIt itOutput) const;
 
+    /// @brief Number of integration points.
+    unsigned pointCount() const noexcept;
+
+    /// @brief Coordinates of all integration points, contiguous per point.
+    std::span<const TValue> points() const noexcept;
+
+    /// @brief Weights of all integration points.
+    std::span<const TValue> weights() const noexcept;
+
 private:
-    DynamicArray<StaticArray<TValue,Dimension+1>> _nodesAndWeights;
+    /// @brief Node coordinates, contiguous per node.
+    DynamicArray<TValue> _points;
+
+    DynamicArray<TValue> _weights;
 }; // class Quadrature
 
 
@@ -0,0 +1,138 @@
+#ifndef CIE_FEM_NUMERIC_SUM_FACTORIZATION_HPP
+#define CIE_FEM_NUMERIC_SUM_FACTORIZATION_HPP
+
+// --- FEM Includes ---
+#include "packages/numeric/inc/QuadratureBase.hpp"
+#include "packages/maths/inc/Expression.hpp"
+
+// --- Utility Includes ---
+#include "packages/stl_extension/inc/DynamicArray.hpp"
+#include "packages/stl_extension/inc/StaticArray.hpp"
+#include "packages/types/inc/types.hpp"
+
+// --- STL Includes ---
+#include <span> // span
+
+
+namespace cie::fem {
+
+
+/// @brief Mass and stiffness kernels of tensor product ansatz spaces on axis-aligned cells.
+/// @details On a cell mapped by an axis-aligned affine transform (@ref maths::ScaleTranslateTransform,
+///          @ref maths::OrthogonalScaleTransform), the local mass and stiffness matrices of an
+///          @ref maths::AnsatzSpace "ansatz space" are sums of Kronecker products of 1D matrices:
+///          @f[
+///             M = \rho |J| \bigotimes_k M^{1D}, \qquad
+///             K = E |J| \sum_k \frac{1}{s_k^2} \bigotimes_l \left( k = l\ ?\ K^{1D} : M^{1D} \right)
+///          @f]
+///          where @f$ s_k @f$ are the scales of the transform along each axis. The 1D matrices are
+///          integrated once at construction with a 1D quadrature, after which
+///          - forming a local matrix costs @f$ \mathcal{O}(d\,n^{2d}) @f$ (proportional to its size) and
+///          - applying a local operator to a coefficient vector costs @f$ \mathcal{O}(d^2 n^{d+1}) @f$,
+///          for @f$ n @f$ scalar basis functions in @f$ d @f$ dimensions, instead of the
+///          @f$ \mathcal{O}(q^d n^{2d}) @f$ of integrating the dense products at each of the @f$ q^d @f$
+///          quadrature nodes.
+///
+///          Unlike @ref maths::LinearIsotropicStiffnessIntegrand, gradients are mapped to physical
+///          coordinates. Local DoFs are ordered like the components of @ref maths::AnsatzSpace::evaluate,
+///          and all members are const and allocation-free, so a single instance can be shared by threads.
+/// @tparam TAnsatzSpace Ansatz space type (see @ref maths::AnsatzSpace).
+template <class TAnsatzSpace>
+class SumFactorization
+{
+public:
+    static constexpr unsigned Dimension = TAnsatzSpace::Dimension;
+
+    using Value = typename TAnsatzSpace::Value;
+
+    using Iterator = Ptr<Value>;
+
+    using ConstIterator = Ptr<const Value>;
+
+public:
+    /// @param rAnsatzSpace Tensor product ansatz space.
+    /// @param rQuadrature 1D quadrature on the reference interval, exact for products
+    ///                    of pairs of scalar basis functions.
+    SumFactorization(Ref<const TAnsatzSpace> rAnsatzSpace,
+                     Ref<const QuadratureBase<Value>> rQuadrature);
+
+    /// @brief Compute the local mass matrix of a cell.
+    /// @param rTransform Axis-aligned affine transform from the reference cell to the cell.
+    /// @param density Coefficient of the mass matrix.
+    /// @param itOut Output for the row-major local mass matrix.
+    template <maths::SpatialTransform TTransform>
+    void computeMass(Ref<const TTransform> rTransform,
+                     Value density,
+                     Iterator itOut) const;
+
+    /// @brief Compute the local stiffness matrix of a cell.
+    /// @param rTransform Axis-aligned affine transform from the reference cell to the cell.
+    /// @param modulus Isotropic stiffness modulus.
+    /// @param itOut Output for the row-major local stiffness matrix.
+    template <maths::SpatialTransform TTransform>
+    void computeStiffness(Ref<const TTransform> rTransform,
+                          Value modulus,
+                          Iterator itOut) const;
+
+    /// @brief Multiply a vector with the local mass matrix of a cell, without forming it.
+    /// @param rTransform Axis-aligned affine transform from the reference cell to the cell.
+    /// @param density Coefficient of the mass matrix.
+    /// @param itInput Local coefficients to multiply, with @ref size components.
+    /// @param itOut Output to overwrite with the product, with @ref size components.
+    /// @param buffer Scratch space of at least @ref getMinBufferSize components.
+    template <maths::SpatialTransform TTransform>
+    void applyMass(Ref<const TTransform> rTransform,
+                   Value density,
+                   ConstIterator itInput,
+                   Iterator itOut,
+                   std::span<Value> buffer) const;
+
+    /// @brief Multiply a vector with the local stiffness matrix of a cell, without forming it.
+    /// @param rTransform Axis-aligned affine transform from the reference cell to the cell.
+    /// @param modulus Isotropic stiffness modulus.
+    /// @param itInput Local coefficients to multiply, with @ref size components.
+    /// @param itOut Output to overwrite with the product, with @ref size components.
+    /// @param buffer Scratch space of at least @ref getMinBufferSize components.
+    template <maths::SpatialTransform TTransform>
+    void applyStiffness(Ref<const TTransform> rTransform,
+                        Value modulus,
+                        ConstIterator itInput,
+                        Iterator itOut,
+                        std::span<Value> buffer) const;
+
+    /// @brief Number of local DoFs.
+    unsigned size() const noexcept;
+
+    /// @brief Number of scalar basis functions along each axis.
+    unsigned setSize() const noexcept;
+
+    unsigned getMinBufferSize() const noexcept;
+
+private:
+    /// @brief Extract the scales of an axis-aligned affine transform along each axis.
+    template <maths::SpatialTransform TTransform>
+    static StaticArray<Value,Dimension> getScales(Ref<const TTransform> rTransform);
+
+    /// @brief Apply one 1D matrix per axis to a tensor of coefficients.
+    /// @details Computes @f$ (A_{d-1} \otimes \dots \otimes A_0)\, x @f$ one axis at a time,
+    ///          alternating between the two halves of @a buffer. Returns the half holding the result.
+    Ptr<const Value> applyKronecker(Ref<const StaticArray<Ptr<const Value>,Dimension>> rFactors,
+                                    ConstIterator itInput,
+                                    std::span<Value> buffer) const;
+
+private:
+    unsigned _setSize;
+
+    /// @brief Row-major 1D mass matrix @f$ \int N_i N_j @f$.
+    DynamicArray<Value> _mass;
+
+    /// @brief Row-major 1D stiffness matrix @f$ \int N_i' N_j' @f$.
+    DynamicArray<Value> _stiffness;
+}; // class SumFactorization
+
+
+} // namespace cie::fem
+
+#include "packages/numeric/impl/SumFactorization_impl.hpp"
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef CIE_FEM_NUMERIC_TABULATION_CACHE_HPP
+#define CIE_FEM_NUMERIC_TABULATION_CACHE_HPP
+
+// --- FEM Includes ---
+#include "packages/numeric/inc/Quadrature.hpp"
+
+// --- Utility Includes ---
+#include "packages/stl_extension/inc/DynamicArray.hpp"
+#include "packages/types/inc/types.hpp"
+
+// --- STL Includes ---
+#include <map> // multimap
+#include <memory> // shared_ptr, weak_ptr
+#include <mutex> // mutex
+#include <span> // span
+#include <utility> // pair
+
+
+namespace cie::fem {
+
+
+/// @brief Values and reference derivatives of an ansatz space at the nodes of a quadrature.
+/// @details Immutable after construction, so a single instance can be read from any
+///          number of threads. Values at each node are stored in the order of
+///          @ref maths::AnsatzSpace::evaluate "TAnsatzSpace::evaluate", and derivatives in the order of
+///          @ref maths::AnsatzSpaceDerivative::evaluate "TAnsatzSpace::Derivative::evaluate", i.e.:
+///          one row of all ansatz functions per spatial direction.
+/// @tparam TAnsatzSpace Ansatz space type (see @ref maths::AnsatzSpace).
+template <class TAnsatzSpace>
+class AnsatzTabulation
+{
+public:
+    static constexpr unsigned Dimension = TAnsatzSpace::Dimension;
+
+    using Value = typename TAnsatzSpace::Value;
+
+    using QuadratureType = Quadrature<Value,Dimension>;
+
+public:
+    AnsatzTabulation(Ref<const TAnsatzSpace> rAnsatzSpace,
+                     Ref<const QuadratureType> rQuadrature);
+
+    /// @brief Number of quadrature nodes.
+    unsigned pointCount() const noexcept;
+
+    /// @brief Number of ansatz functions.
+    unsigned ansatzCount() const noexcept;
+
+    /// @brief Coordinates of a quadrature node.
+    std::span<const Value,Dimension> getPoint(unsigned iPoint) const;
+
+    /// @brief Weight of a quadrature node.
+    Value getWeight(unsigned iPoint) const;
+
+    /// @brief Ansatz function values at a quadrature node.
+    std::span<const Value> getValues(unsigned iPoint) const;
+
+    /// @brief Reference derivatives of the ansatz functions at a quadrature node.
+    std::span<const Value> getDerivatives(unsigned iPoint) const;
+
+private:
+    unsigned _ansatzCount;
+
+    /// @brief Node coordinates, contiguous per node.
+    DynamicArray<Value> _points;
+
+    DynamicArray<Value> _weights;
+
+    DynamicArray<Value> _values;
+
+    DynamicArray<Value> _derivatives;
+}; // class AnsatzTabulation
+
+
+/// @brief Thread-safe store of @ref AnsatzTabulation "tabulations" keyed by ansatz space and quadrature.
+/// @details Each combination is tabulated on first request and shared afterwards. Ansatz spaces are
+///          identified by their shared scalar basis (see @ref maths::AnsatzSpace::sharedAnsatzSet), so
+///          copies of an ansatz space share their tabulations. Quadratures are identified by their nodes
+///          and weights, so equal quadratures share tabulations regardless of where they are stored.
+///          The cache does not keep ansatz spaces alive: tabulations of destroyed ones are discarded
+///          instead of being returned for a new ansatz space that happens to reuse their storage.
+/// @tparam TAnsatzSpace Ansatz space type (see @ref maths::AnsatzSpace).
+template <class TAnsatzSpace>
+class TabulationCache
+{
+public:
+    using Tabulation = AnsatzTabulation<TAnsatzSpace>;
+
+public:
+    /// @brief Get the tabulation of an ansatz space at the nodes of a quadrature, computing it if necessary.
+    std::shared_ptr<const Tabulation> get(Ref<const TAnsatzSpace> rAnsatzSpace,
+                                          Ref<const typename Tabulation::QuadratureType> rQuadrature);
+
+    /// @brief Number of cached tabulations, including ones of destroyed ansatz spaces that were not discarded yet.
+    std::size_t size() const;
+
+    void clear();
+
+private:
+    using AnsatzSet = typename TAnsatzSpace::AnsatzSet;
+
+    /// @brief Address of the scalar basis and hash of the quadrature's nodes and weights.
+    using Key = std::pair<Ptr<const AnsatzSet>,std::size_t>;
+
+    struct Entry
+    {
+        std::weak_ptr<const AnsatzSet> pAnsatzSet;
+
+        std::shared_ptr<const Tabulation> pTabulation;
+    }; // struct Entry
+
+    static std::size_t hash(Ref<const typename Tabulation::QuadratureType> rQuadrature) noexcept;
+
+    /// @brief Check whether a tabulation was computed at the nodes and weights of a quadrature.
+    static bool matches(Ref<const Tabulation> rTabulation,
+                        Ref<const typename Tabulation::QuadratureType> rQuadrature) noexcept;
+
+    mutable std::mutex _mutex;
+
+    std::multimap<Key,Entry> _tabulations;
+}; // class TabulationCache
+
+
+} // namespace cie::fem
+
+#include "packages/numeric/impl/TabulationCache_impl.hpp"
+
+#endif
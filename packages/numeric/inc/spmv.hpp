@@ -0,0 +1,96 @@
+#ifndef CIE_FEM_NUMERIC_SPMV_HPP
+#define CIE_FEM_NUMERIC_SPMV_HPP
+
+// --- Utility Includes ---
+#include "packages/stl_extension/inc/DynamicArray.hpp"
+#include "packages/stl_extension/inc/OptionalRef.hpp"
+#include "packages/concurrency/inc/ThreadPoolBase.hpp"
+#include "packages/types/inc/types.hpp"
+
+
+namespace cie::fem {
+
+
+/** @brief Compute the product of a CSR matrix and a vector.
+ *  @param rRowExtents Row extents of the matrix.
+ *  @param rColumnIndices Column indices of the matrix.
+ *  @param rNonzeros Nonzeros of the matrix.
+ *  @param pInput Vector to multiply, with as many components as the matrix has columns.
+ *  @param pOutput Vector to overwrite with the product, with as many components as the matrix has rows.
+ *  @param rThreadPool Optional thread pool to distribute rows on.
+ */
+template <class TIndex, class TValue>
+void spmv(Ref<const DynamicArray<TIndex>> rRowExtents,
+          Ref<const DynamicArray<TIndex>> rColumnIndices,
+          Ref<const DynamicArray<TValue>> rNonzeros,
+          Ptr<const TValue> pInput,
+          Ptr<TValue> pOutput,
+          OptionalRef<mp::ThreadPoolBase> rThreadPool = {});
+
+
+/** @brief Compute the product of a symmetric matrix, of which only the upper triangle is stored in CSR format, and a vector.
+ *  @details Each stored off-diagonal entry contributes to two components of the product,
+ *           so every nonzero is loaded once. With a thread pool, rows are split into one chunk
+ *           per thread. Transposed contributions of a chunk that fall into its own rows are added
+ *           to the output directly. The rest can only fall into the rows between the end of the
+ *           chunk and its largest column, and are accumulated in a buffer covering just those rows,
+ *           which gets reduced at the end. For banded matrices (eg: after @ref makeReverseCuthillMcKeeOrdering),
+ *           each chunk's buffer is about as long as the bandwidth.
+ *  @param rRowExtents Row extents of the upper triangle (see @ref BasicAssembler::makeSymmetricCSRMatrix).
+ *  @param rColumnIndices Column indices of the upper triangle, sorted within each row.
+ *  @param rNonzeros Nonzeros of the upper triangle.
+ *  @param pInput Vector to multiply, with as many components as the matrix has rows.
+ *  @param pOutput Vector to overwrite with the product, with as many components as the matrix has rows.
+ *  @param rThreadPool Optional thread pool to distribute rows on.
+ *  @note This overload allocates the accumulators on each call if a thread pool is provided.
+ *        Repeated products (eg: in iterative solvers) should pass a persistent buffer instead.
+ */
+template <class TIndex, class TValue>
+void symmetricSpmv(Ref<const DynamicArray<TIndex>> rRowExtents,
+                   Ref<const DynamicArray<TIndex>> rColumnIndices,
+                   Ref<const DynamicArray<TValue>> rNonzeros,
+                   Ptr<const TValue> pInput,
+                   Ptr<TValue> pOutput,
+                   OptionalRef<mp::ThreadPoolBase> rThreadPool = {});
+
+
+/** @brief Compute the product of a symmetric matrix, of which only the upper triangle is stored in CSR format, and a vector.
+ *  @details Identical to the overload without a buffer, but accumulates the contributions of
+ *           the transposed entries in @a rBuffer. The buffer only grows, so passing the same one
+ *           to repeated products avoids allocating memory after the first call.
+ *  @param rBuffer Scratch space for the accumulators, resized as necessary.
+ */
+template <class TIndex, class TValue>
+void symmetricSpmv(Ref<const DynamicArray<TIndex>> rRowExtents,
+                   Ref<const DynamicArray<TIndex>> rColumnIndices,
+                   Ref<const DynamicArray<TValue>> rNonzeros,
+                   Ptr<const TValue> pInput,
+                   Ptr<TValue> pOutput,
+                   Ref<DynamicArray<TValue>> rBuffer,
+                   OptionalRef<mp::ThreadPoolBase> rThreadPool = {});
+
+
+/** @brief Compute the product of a block sparse row (BSR) matrix and a vector.
+ *  @param blockSize Number of rows and columns of each dense block.
+ *  @param rRowExtents Extents of each block row (see @ref BasicAssembler::makeBSRMatrix).
+ *  @param rColumnIndices Block column index of each block.
+ *  @param rNonzeros Entries of all blocks, each stored contiguously in row-major order.
+ *  @param pInput Vector to multiply, with @a blockSize components per block column.
+ *  @param pOutput Vector to overwrite with the product, with @a blockSize components per block row.
+ *  @param rThreadPool Optional thread pool to distribute block rows on.
+ */
+template <class TIndex, class TValue>
+void blockSpmv(std::size_t blockSize,
+               Ref<const DynamicArray<TIndex>> rRowExtents,
+               Ref<const DynamicArray<TIndex>> rColumnIndices,
+               Ref<const DynamicArray<TValue>> rNonzeros,
+               Ptr<const TValue> pInput,
+               Ptr<TValue> pOutput,
+               OptionalRef<mp::ThreadPoolBase> rThreadPool = {});
+
+
+} // namespace cie::fem
+
+#include "packages/numeric/impl/spmv_impl.hpp"
+
+#endif
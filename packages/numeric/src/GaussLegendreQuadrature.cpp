@@ -1,5 +1,3 @@
-#define __STDCPP_WANT_MATH_SPEC_FUNCS__ 1
-
 // --- Utility Includes ---
 #include "packages/macros/inc/checks.hpp"
 
@@ -12,68 +10,11 @@
 // --- STL Includes ---
 #include <cmath>
 #include <numbers>
-#include <functional>
 #include <limits>
-
-#if __STDCPP_MATH_SPEC_FUNCS__ < 201003L // I hate clang
-
-#ifndef __clang__
-static_assert(false, "terribleLegendre is supposed to replace std::legendre exclusively on clang");
-#endif
-
-#include "tsl/robin_map.h"
-
-/** @brief Naive recursive evaluation of a Legendre polynomial.
- *  @details This function directly uses Legendre polynomials'
- *           recurrence relation to compute their values at the
- *           given argument in [-1,1]. The recurrence relation
- *           reads:
- *           @f[
- *              p_0(x) &= 1 \
- *              p_1(x) &= x \
- *              p_k(x) &= \frac{2(k-1)+1}{k} x p_{k-1}(x)
- *                        -  \frac{k-1}{k}p_{k-2}(x)
- *           @f]
- *  @note Both performance and accuracy are terrible. Ideally,
- *        one would use the standard implementation instead, but
- *        clang still hasn't implemented mathematical special
- *        functions that have been part of the standard since C++17.
- *  @todo Replace @a terribleLegendre with @ref std::legendre once
- *        it gets implemented in clang's standard library, or use
- *        the boost implementation instead.
- */
-long double terribleLegendre(std::size_t order,
-                             long double x,
-                             tsl::robin_map<std::size_t,long double>& r_cache)
-{
-    if (order == 0) {
-        return 1.0;
-    } else if (order == 1) {
-        return x;
-    } else {
-        const auto it = r_cache.find(order);
-        if (it == r_cache.end()) {
-            const long double prev = terribleLegendre(order - 1, x, r_cache);
-            const long double prevPrev = terribleLegendre(order - 2, x, r_cache);
-            const long double current = (2 * (order - 1) + 1) / (long double)order * x * prev
-                                      - (order - 1) / (long double)order * prevPrev;
-            r_cache.emplace(order, current);
-            return current;
-        } else {
-            return it->second;
-        }
-    }
-}
-
-namespace std {
-double legendre(size_t order, double x)
-{
-    tsl::robin_map<std::size_t,long double> cache;
-    return terribleLegendre(order, x, cache);
-}
-} // namespace std
-
-#endif
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
 
 
 namespace cie::fem {
@@ -82,78 +23,87 @@ namespace cie::fem {
 template <class T>
 struct GaussLegendreInitializer
 {
-    static std::pair<typename GaussLegendreQuadrature<T>::NodeContainer,
-                     typename GaussLegendreQuadrature<T>::WeightContainer>
-    getNodesAndWeights(Size integrationOrder,
-                       utils::Comparison<T> comparison,
-                       Size maxIterations)
+    using NodesAndWeights = std::pair<typename GaussLegendreQuadrature<T>::NodeContainer,
+                                      typename GaussLegendreQuadrature<T>::WeightContainer>;
+
+    /// @brief Precision the recurrence is evaluated in (at least double).
+    using Work = std::common_type_t<T,double>;
+
+    static Ref<const NodesAndWeights> getCachedNodesAndWeights(Size integrationOrder)
+    {
+        CIE_BEGIN_EXCEPTION_TRACING
+
+        // Rules are never erased and map nodes are stable,
+        // so references into the map remain valid.
+        static std::shared_mutex mutex;
+        static std::map<Size,NodesAndWeights> rules;
+
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            const auto it = rules.find(integrationOrder);
+            if (it != rules.end()) return it->second;
+        }
+
+        // Compute the rule without holding the lock. If another thread
+        // inserted it in the meantime, emplace keeps the existing one.
+        const T tolerance = 0x100 * std::numeric_limits<T>::epsilon();
+        auto nodesAndWeights = getNodesAndWeights(integrationOrder, {tolerance, tolerance}, 50ul);
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        return rules.emplace(integrationOrder, std::move(nodesAndWeights)).first->second;
+
+        CIE_END_EXCEPTION_TRACING
+    }
+
+    static NodesAndWeights getNodesAndWeights(Size integrationOrder,
+                                              utils::Comparison<T> comparison,
+                                              Size maxIterations)
     {
         CIE_BEGIN_EXCEPTION_TRACING
 
         CIE_CHECK(0 < integrationOrder, "the integration order must be positive")
         CIE_CHECK(0 < maxIterations, "the maximum number of Newton iterations must be at least 1")
 
-        std::pair<typename GaussLegendreQuadrature<T>::NodeContainer, typename GaussLegendreQuadrature<T>::WeightContainer> nodesAndWeights;
+        NodesAndWeights nodesAndWeights;
         auto& r_nodes   = nodesAndWeights.first;
         auto& r_weights = nodesAndWeights.second;
 
         r_nodes.resize(integrationOrder);
         r_weights.resize(integrationOrder);
 
-        T legendreValue      = std::numeric_limits<T>::max();
-        T legendreDerivative = std::numeric_limits<T>::max();
-
-        // Handle symmetry
-        Size i_pivot;
-        if (integrationOrder % 2 == 1) {
-            i_pivot = integrationOrder / 2 + 1;
-            r_nodes[i_pivot] = 0;
-
-            T weight = integrationOrder * std::legendre(integrationOrder-1, T(0));
-            weight = 2 / weight / weight;
-            r_weights[i_pivot] = weight;
-
-            --i_pivot;
-        } else {
-            i_pivot = integrationOrder / 2;
-        }
-
-        // Compute nodes and weights
-        const Size integrationOrderM1 = integrationOrder - 1;
-
-        for (Size index=0; index<=i_pivot; ++index) {
-            bool converged = false;
-            T node        = approximateLegendreRoot(integrationOrder, index);
-            T oneMinusNode2 = 1 - node*node;
-
-            // Newton iteration
-            for (Size iteration=0; iteration<maxIterations; ++iteration) {
-                // Update helpers
-                legendreValue = std::legendre(integrationOrder, node);
-
-                legendreDerivative = integrationOrder * (-node*legendreValue + std::legendre(integrationOrderM1, node));
-                legendreDerivative /= oneMinusNode2;
-
-                // Check convergence
-                if (comparison.equal(std::abs(legendreValue), T(0))) { /// @todo this is incorrect => check node position error instead of value
-                    converged = true;
-                    break;
+        // Compute the nodes on the negative half, and mirror them.
+        // The middle node of odd rules is exactly 0.
+        for (Size index=0; index<(integrationOrder + 1) / 2; ++index) {
+            Work node = 0;
+            Work legendreDerivative = 0;
+
+            if (integrationOrder % 2 == 1 && index == integrationOrder / 2) {
+                legendreDerivative = evaluateLegendre(integrationOrder, node).second;
+            } else {
+                bool converged = false;
+                node = approximateLegendreRoot(integrationOrder, index);
+
+                // Newton iteration
+                for (Size iteration=0; iteration<maxIterations; ++iteration) {
+                    const auto [legendreValue, derivative] = evaluateLegendre(integrationOrder, node);
+                    const Work update = legendreValue / derivative;
+                    node -= update;
+                    if (comparison.equal(static_cast<T>(update), T(0))) {
+                        converged = true;
+                        break;
+                    }
                 }
 
-                // Update
-                node          -= legendreValue / legendreDerivative;
-                oneMinusNode2 = 1 - node*node;
+                CIE_CHECK(converged,
+                          "Computation of Gauss-Legendre nodes failed to converge within "
+                          << maxIterations << " iterations for node " << index << "\n")
+                legendreDerivative = evaluateLegendre(integrationOrder, node).second;
             }
 
-            CIE_CHECK(converged,
-                      "Computation of Gauss-Legendre nodes failed to converge within "
-                      << maxIterations << " iterations for node " << index << "\n")
-
-            T weight = 2 / legendreDerivative / legendreDerivative / oneMinusNode2;
-            Size symmetricIndex       = integrationOrder - index - 1;
-            r_nodes[index]            = node;
+            const T weight = 2 / (legendreDerivative * legendreDerivative * (1 - node * node));
+            const Size symmetricIndex = integrationOrder - index - 1;
+            r_nodes[index]            = static_cast<T>(node);
             r_weights[index]          = weight;
-            r_nodes[symmetricIndex]   = -node;
+            r_nodes[symmetricIndex]   = static_cast<T>(-node);
             r_weights[symmetricIndex] = weight;
         }
 
@@ -162,15 +112,33 @@ struct GaussLegendreInitializer
         CIE_END_EXCEPTION_TRACING
     }
 
-    static T approximateLegendreRoot(Size order, Size index)
+    /** @brief Evaluate a Legendre polynomial and its derivative with the three-term recurrence.
+     *  @details @f[
+     *              (k+1) P_{k+1}(x) = (2k+1) x P_k(x) - k P_{k-1}(x), \qquad
+     *              (1 - x^2) P_n'(x) = n (P_{n-1}(x) - x P_n(x))
+     *           @f]
+     *           The order must be positive and the argument must lie in the open interval (-1, 1).
+     */
+    static std::pair<Work,Work> evaluateLegendre(Size order, Work x) noexcept
+    {
+        Work previous = 1, current = x;
+        for (Size degree=1; degree<order; ++degree) {
+            const Work next = ((2 * degree + 1) * x * current - degree * previous) / (degree + 1);
+            previous = current;
+            current = next;
+        }
+        return {current, order * (previous - x * current) / (1 - x * x)};
+    }
+
+    static Work approximateLegendreRoot(Size order, Size index)
     {
         CIE_BEGIN_EXCEPTION_TRACING
 
         index = order - index;
-        const T eighth = T(1) / T(8);
+        const Work eighth = Work(1) / Work(8);
 
-        T output = T(1) - (eighth - eighth/order)/(order*order);
-        output *= std::cos(std::numbers::pi * T(4*index-1)/T(4*order + 2));
+        Work output = Work(1) - (eighth - eighth/order)/(order*order);
+        output *= std::cos(std::numbers::pi_v<Work> * Work(4*index-1)/Work(4*order + 2));
 
         return output;
 
@@ -179,6 +147,13 @@ struct GaussLegendreInitializer
 };
 
 
+template <concepts::Numeric NT>
+GaussLegendreQuadrature<NT>::GaussLegendreQuadrature(Size integrationOrder)
+    : QuadratureBase<NT>(typename GaussLegendreInitializer<NT>::NodesAndWeights(GaussLegendreInitializer<NT>::getCachedNodesAndWeights(integrationOrder)))
+{
+}
+
+
 template <concepts::Numeric NT>
 GaussLegendreQuadrature<NT>::GaussLegendreQuadrature(Size integrationOrder,
                                                      utils::Comparison<NT> comparison,
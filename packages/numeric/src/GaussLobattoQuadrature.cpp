@@ -0,0 +1,123 @@
+// --- Utility Includes ---
+#include "packages/macros/inc/checks.hpp"
+
+// --- FEM Incldues ---
+#include "packages/utilities/inc/template_macros.hpp"
+
+// --- Internal Includes ---
+#include "packages/numeric/inc/GaussLobattoQuadrature.hpp"
+
+// --- STL Includes ---
+#include <cmath>
+#include <numbers>
+#include <type_traits>
+
+
+namespace cie::fem {
+
+
+template <class T>
+struct GaussLobattoInitializer
+{
+    using NodesAndWeights = std::pair<typename GaussLobattoQuadrature<T>::NodeContainer,
+                                      typename GaussLobattoQuadrature<T>::WeightContainer>;
+
+    /// @brief Precision the recurrence is evaluated in (at least double).
+    using Work = std::common_type_t<T,double>;
+
+    static NodesAndWeights getNodesAndWeights(Size integrationOrder,
+                                              utils::Comparison<T> comparison,
+                                              Size maxIterations)
+    {
+        CIE_BEGIN_EXCEPTION_TRACING
+
+        CIE_CHECK(2 <= integrationOrder, "Gauss-Lobatto rules require at least 2 nodes")
+        CIE_CHECK(0 < maxIterations, "the maximum number of Newton iterations must be at least 1")
+
+        NodesAndWeights nodesAndWeights;
+        auto& r_nodes   = nodesAndWeights.first;
+        auto& r_weights = nodesAndWeights.second;
+
+        r_nodes.resize(integrationOrder);
+        r_weights.resize(integrationOrder);
+
+        // Interior nodes are the roots of P_m' with m = n - 1
+        const Size order = integrationOrder - 1;
+        const Work weightScale = Work(2) / Work(order * (order + 1));
+
+        // Compute the nodes on the negative half, and mirror them.
+        // The first node is -1, and the middle node of odd rules is exactly 0.
+        for (Size index=0; index<(integrationOrder + 1) / 2; ++index) {
+            Work node = -1;
+
+            if (integrationOrder % 2 == 1 && index == integrationOrder / 2) {
+                node = 0;
+            } else if (index != 0) {
+                bool converged = false;
+
+                // Start from the Chebyshev-Gauss-Lobatto node
+                node = -std::cos(std::numbers::pi_v<Work> * Work(index) / Work(order));
+
+                // Newton iteration on (1-x^2) P_m'(x) = m (P_{m-1}(x) - x P_m(x)),
+                // whose derivative is -m (m+1) P_m(x).
+                for (Size iteration=0; iteration<maxIterations; ++iteration) {
+                    const auto [legendreValue, previousValue] = evaluateLegendre(order, node);
+                    const Work update = (node * legendreValue - previousValue) / ((order + 1) * legendreValue);
+                    node -= update;
+                    if (comparison.equal(static_cast<T>(update), T(0))) {
+                        converged = true;
+                        break;
+                    }
+                }
+
+                CIE_CHECK(converged,
+                          "Computation of Gauss-Lobatto nodes failed to converge within "
+                          << maxIterations << " iterations for node " << index << "\n")
+            }
+
+            const Work legendreValue = evaluateLegendre(order, node).first;
+            const T weight = weightScale / (legendreValue * legendreValue);
+            const Size symmetricIndex = integrationOrder - index - 1;
+            r_nodes[index]            = static_cast<T>(node);
+            r_weights[index]          = weight;
+            r_nodes[symmetricIndex]   = static_cast<T>(-node);
+            r_weights[symmetricIndex] = weight;
+        }
+
+        return nodesAndWeights;
+
+        CIE_END_EXCEPTION_TRACING
+    }
+
+    /** @brief Evaluate the Legendre polynomials of the provided and the previous order.
+     *  @details @f[ (k+1) P_{k+1}(x) = (2k+1) x P_k(x) - k P_{k-1}(x) @f]
+     *  @returns @f$ (P_n(x), P_{n-1}(x)) @f$ for a positive order @a n.
+     */
+    static std::pair<Work,Work> evaluateLegendre(Size order, Work x) noexcept
+    {
+        Work previous = 1, current = x;
+        for (Size degree=1; degree<order; ++degree) {
+            const Work next = ((2 * degree + 1) * x * current - degree * previous) / (degree + 1);
+            previous = current;
+            current = next;
+        }
+        return {current, previous};
+    }
+};
+
+
+template <concepts::Numeric NT>
+GaussLobattoQuadrature<NT>::GaussLobattoQuadrature(Size integrationOrder,
+                                                   utils::Comparison<NT> comparison,
+                                                   Size maxNewtonIterations)
+    : QuadratureBase<NT>(GaussLobattoInitializer<NT>::getNodesAndWeights(integrationOrder,
+                                                                         comparison,
+                                                                         maxNewtonIterations))
+{
+}
+
+
+CIE_FEM_INSTANTIATE_NUMERIC_TEMPLATE(GaussLobattoQuadrature);
+
+
+} // namespace cie::fem
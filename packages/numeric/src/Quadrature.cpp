@@ -24,14 +24,17 @@ Quadrature<TValue,Dimension>::Quadrature(Ref<const QuadratureBase<TValue>> r_bas
 template <concepts::Numeric TValue, unsigned Dimension>
 Quadrature<TValue,Dimension>::Quadrature(Ref<const typename QuadratureBase<TValue>::NodeContainer> r_nodes,
                                          Ref<const typename QuadratureBase<TValue>::WeightContainer> r_weights)
-    : _nodesAndWeights()
+    : _points(),
+      _weights()
 {
     const unsigned numberOfNodes = r_nodes.size();
     CIE_OUT_OF_RANGE_CHECK(numberOfNodes == r_weights.size())
 
     if (!r_nodes.empty()) {
         // Resize nodes and weights
-        this->_nodesAndWeights.resize(intPow(r_nodes.size(), Dimension));
+        const Size pointCount = intPow(r_nodes.size(), Dimension);
+        this->_points.resize(pointCount * Dimension);
+        this->_weights.resize(pointCount);
 
         // Create an index buffer for constructing the outer product
         StaticArray<unsigned,Dimension> indexBuffer;
@@ -40,24 +43,43 @@ Quadrature<TValue,Dimension>::Quadrature(Ref<const typename QuadratureBase<TValu
                   0);
 
         // Construct the outer product
-        auto it_item = this->_nodesAndWeights.begin();
+        auto it_point = this->_points.begin();
+        auto it_weight = this->_weights.begin();
         do {
             // Compute the current component of the outer product
-            std::fill(it_item->begin(),
-                      it_item->end(),
-                      static_cast<TValue>(1));
-            Ref<TValue> r_weight = it_item->back();
+            *it_weight = static_cast<TValue>(1);
             for (unsigned i_index=0; i_index<indexBuffer.size(); ++i_index) {
                 const auto i = indexBuffer[i_index];
-                it_item->at(i_index) = r_nodes[i];
-                r_weight *= r_weights[i];
+                *it_point++ = r_nodes[i];
+                *it_weight *= r_weights[i];
             } // for index in indexBuffer
-            ++it_item;
+            ++it_weight;
         } while (maths::OuterProduct<Dimension>::next(numberOfNodes, indexBuffer.data()));
     } // if r_nodes
 }
 
 
+template <concepts::Numeric TValue, unsigned Dimension>
+unsigned Quadrature<TValue,Dimension>::pointCount() const noexcept
+{
+    return _weights.size();
+}
+
+
+template <concepts::Numeric TValue, unsigned Dimension>
+std::span<const TValue> Quadrature<TValue,Dimension>::points() const noexcept
+{
+    return _points;
+}
+
+
+template <concepts::Numeric TValue, unsigned Dimension>
+std::span<const TValue> Quadrature<TValue,Dimension>::weights() const noexcept
+{
+    return _weights;
+}
+
+
 CIE_FEM_INSTANTIATE_TEMPLATE(Quadrature);
 
 
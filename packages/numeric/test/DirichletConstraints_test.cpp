@@ -0,0 +1,96 @@
+// --- Utility Includes ---
+#include "packages/testing/inc/essentials.hpp"
+#include "packages/stl_extension/inc/DynamicArray.hpp"
+
+// --- FEM Includes ---
+#include "packages/numeric/inc/DirichletConstraints.hpp"
+
+
+namespace cie::fem {
+
+
+CIE_TEST_CASE("DirichletConstraints", "[numeric]")
+{
+    CIE_TEST_CASE_INIT("DirichletConstraints")
+
+    /**
+     *  [ 4 -1  0  0  2 ]
+     *  [-1  4 -1  0  0 ]
+     *  [ 0 -1  4 -1  0 ]
+     *  [ 0  0 -1  4 -1 ]
+     *  [ 2  0  0 -1  4 ]
+     */
+    const DynamicArray<int> rowExtents {0, 3, 6, 9, 12, 15};
+    const DynamicArray<int> columnIndices {0, 1, 4,   0, 1, 2,   1, 2, 3,   2, 3, 4,   0, 3, 4};
+    const DynamicArray<double> nonzeros {4, -1, 2,   -1, 4, -1,   -1, 4, -1,   -1, 4, -1,   2, -1, 4};
+    const DynamicArray<double> rhs(5, 1.0);
+
+    // u_1 = 2, u_4 = -1
+    DirichletConstraints<double> constraints(5);
+    CIE_TEST_CHECK(constraints.size() == 0);
+    CIE_TEST_CHECK(constraints.dofCount() == 5);
+    CIE_TEST_CHECK_NOTHROW(constraints.addConstraint(1, 0.0));
+    CIE_TEST_CHECK_NOTHROW(constraints.addConstraint(4, -1.0));
+    CIE_TEST_CHECK_NOTHROW(constraints.addConstraint(1, 2.0));
+    CIE_TEST_CHECK(constraints.size() == 2);
+
+    for (std::size_t iDoF=0ul; iDoF<5ul; ++iDoF) {
+        CIE_TEST_CHECK(constraints.isConstrained(iDoF) == (iDoF == 1 || iDoF == 4));
+    }
+    CIE_TEST_CHECK(!constraints.isConstrained(5));
+    CIE_TEST_CHECK(constraints.getValue(1) == 2.0);
+    CIE_TEST_CHECK(constraints.getValue(4) == -1.0);
+    CIE_TEST_CHECK_THROWS(constraints.getValue(0));
+
+    const auto check = [&](ConstraintImposition imposition,
+                           Ref<const DynamicArray<double>> rReferenceNonzeros,
+                           Ref<const DynamicArray<double>> rReferenceRhs,
+                           OptionalRef<mp::ThreadPoolBase> rThreadPool) {
+        DynamicArray<double> constrainedNonzeros = nonzeros;
+        DynamicArray<double> constrainedRhs = rhs;
+        CIE_TEST_CHECK_NOTHROW(constraints.apply(rowExtents,
+                                                 columnIndices,
+                                                 constrainedNonzeros,
+                                                 constrainedRhs.data(),
+                                                 imposition,
+                                                 rThreadPool));
+        for (std::size_t iEntry=0ul; iEntry<nonzeros.size(); ++iEntry) {
+            CIE_TEST_CHECK(constrainedNonzeros[iEntry] == Approx(rReferenceNonzeros[iEntry]));
+        }
+        for (std::size_t iRow=0ul; iRow<rhs.size(); ++iRow) {
+            CIE_TEST_CHECK(constrainedRhs[iRow] == Approx(rReferenceRhs[iRow]));
+        }
+    };
+
+    mp::ThreadPoolBase threadPool(2);
+
+    {
+        CIE_TEST_CASE_INIT("symmetric elimination")
+        const DynamicArray<double> referenceNonzeros {4, 0, 0,   0, 1, 0,   0, 4, -1,   -1, 4, 0,   0, 0, 1};
+        const DynamicArray<double> referenceRhs {5, 2, 3, 0, -1};
+        check(ConstraintImposition::SymmetricElimination, referenceNonzeros, referenceRhs, {});
+        check(ConstraintImposition::SymmetricElimination, referenceNonzeros, referenceRhs, threadPool);
+    }
+
+    {
+        CIE_TEST_CASE_INIT("row replacement")
+        const DynamicArray<double> referenceNonzeros {4, -1, 2,   0, 1, 0,   -1, 4, -1,   -1, 4, -1,   0, 0, 1};
+        const DynamicArray<double> referenceRhs {1, 2, 1, 1, -1};
+        check(ConstraintImposition::RowReplacement, referenceNonzeros, referenceRhs, {});
+        check(ConstraintImposition::RowReplacement, referenceNonzeros, referenceRhs, threadPool);
+    }
+
+    {
+        CIE_TEST_CASE_INIT("missing diagonal")
+        const DynamicArray<int> offDiagonalColumns {1, 2, 3,   0, 2, 3,   0, 1, 3,   0, 1, 2,   0, 1, 2};
+        DynamicArray<double> constrainedNonzeros = nonzeros;
+        DynamicArray<double> constrainedRhs = rhs;
+        CIE_TEST_CHECK_THROWS(constraints.apply(rowExtents,
+                                                offDiagonalColumns,
+                                                constrainedNonzeros,
+                                                constrainedRhs.data()));
+    }
+}
+
+
+} // namespace cie::fem
@@ -6,6 +6,8 @@
 
 // --- STL Includes ---
 #include <cmath>
+#include <thread>
+#include <algorithm>
 
 
 namespace cie::fem {
@@ -152,6 +154,58 @@ CIE_TEST_CASE( "GaussLegendreQuadrature", "[numeric]" )
             CIE_TEST_CHECK(quadrature.weights()[index] == Approx(reference.second[index]).margin(maxAbsoluteError));
         }
     }
+
+    {
+        CIE_TEST_CASE_INIT("order = 300")
+
+        const Size integrationOrder = 300;
+        GaussLegendreQuadrature<double> quadrature(integrationOrder, comparison, maxIterations);
+        CIE_TEST_REQUIRE(quadrature.nodes().size() == integrationOrder);
+        CIE_TEST_CHECK(std::is_sorted(quadrature.nodes().begin(), quadrature.nodes().end()));
+
+        // Exact for all even monomials up to degree 2 * integrationOrder - 2
+        for (Size exponent : {0ul, 2ul, 50ul, 300ul, 598ul}) {
+            double integral = 0.0;
+            for (Size index=0; index<integrationOrder; ++index) {
+                integral += quadrature.weights()[index] * std::pow(quadrature.nodes()[index], double(exponent));
+            }
+            CIE_TEST_CHECK(integral == Approx(2.0 / (exponent + 1.0)).epsilon(1e-12));
+        }
+    }
+}
+
+
+CIE_TEST_CASE("GaussLegendreQuadrature cache", "[numeric]")
+{
+    CIE_TEST_CASE_INIT("GaussLegendreQuadrature cache")
+
+    const Size integrationOrder = 17;
+    const GaussLegendreQuadrature<double> reference(integrationOrder, utils::Comparison<double>(5e-15, 1e-14));
+
+    // Construct the same rule from several threads at once
+    DynamicArray<GaussLegendreQuadrature<double>> quadratures(8);
+    {
+        DynamicArray<std::thread> threads;
+        for (auto& rQuadrature : quadratures) {
+            threads.emplace_back([&rQuadrature, integrationOrder] () {rQuadrature = GaussLegendreQuadrature<double>(integrationOrder);});
+        }
+        for (auto& rThread : threads) rThread.join();
+    }
+
+    for (const auto& rQuadrature : quadratures) {
+        CIE_TEST_REQUIRE(rQuadrature.nodes().size() == integrationOrder);
+        for (Size index=0; index<integrationOrder; ++index) {
+            CIE_TEST_CHECK(rQuadrature.nodes()[index] == quadratures.front().nodes()[index]);
+            CIE_TEST_CHECK(rQuadrature.weights()[index] == quadratures.front().weights()[index]);
+            CIE_TEST_CHECK(rQuadrature.nodes()[index] == Approx(reference.nodes()[index]).margin(1e-15));
+            CIE_TEST_CHECK(rQuadrature.weights()[index] == Approx(reference.weights()[index]).margin(1e-15));
+        }
+    }
+
+    const GaussLegendreQuadrature<float> singlePrecision(64);
+    float weightSum = 0.0f;
+    for (const float weight : singlePrecision.weights()) weightSum += weight;
+    CIE_TEST_CHECK(weightSum == Approx(2.0f).epsilon(1e-5));
 }
 
 
@@ -0,0 +1,121 @@
+// ---- Utility Includes ---
+#include "packages/testing/inc/essentials.hpp"
+
+// --- FEM Includes ---
+#include "packages/maths/inc/LagrangePolynomial.hpp"
+#include "packages/maths/inc/AnsatzSpace.hpp"
+#include "packages/numeric/inc/Quadrature.hpp"
+
+// --- Internal Includes ---
+#include "packages/numeric/inc/GaussLobattoQuadrature.hpp"
+
+// --- STL Includes ---
+#include <cmath>
+#include <iterator>
+
+
+namespace cie::fem {
+
+
+CIE_TEST_CASE("GaussLobattoQuadrature", "[numeric]")
+{
+    CIE_TEST_CASE_INIT("GaussLobattoQuadrature")
+
+    const double maxAbsoluteError = 5e-15;
+    const utils::Comparison<double> comparison(5e-15, 1e-14);
+
+    CIE_TEST_CHECK_THROWS(GaussLobattoQuadrature<double>(1, comparison));
+
+    {
+        CIE_TEST_CASE_INIT("order = 2")
+        const GaussLobattoQuadrature<double> quadrature(2, comparison);
+        CIE_TEST_REQUIRE(quadrature.nodes().size() == 2);
+        CIE_TEST_CHECK(quadrature.nodes()[0] == -1.0);
+        CIE_TEST_CHECK(quadrature.nodes()[1] == 1.0);
+        CIE_TEST_CHECK(quadrature.weights()[0] == Approx(1.0).margin(maxAbsoluteError));
+        CIE_TEST_CHECK(quadrature.weights()[1] == Approx(1.0).margin(maxAbsoluteError));
+    }
+
+    {
+        CIE_TEST_CASE_INIT("order = 5")
+        const GaussLobattoQuadrature<double> quadrature(5, comparison);
+        const DynamicArray<double> nodes {-1.0, -std::sqrt(3.0 / 7.0), 0.0, std::sqrt(3.0 / 7.0), 1.0};
+        const DynamicArray<double> weights {0.1, 49.0 / 90.0, 32.0 / 45.0, 49.0 / 90.0, 0.1};
+        CIE_TEST_REQUIRE(quadrature.nodes().size() == nodes.size());
+        for (Size index=0; index<nodes.size(); ++index) {
+            CIE_TEST_CHECK(quadrature.nodes()[index] == Approx(nodes[index]).margin(maxAbsoluteError));
+            CIE_TEST_CHECK(quadrature.weights()[index] == Approx(weights[index]).margin(maxAbsoluteError));
+        }
+    }
+
+    {
+        CIE_TEST_CASE_INIT("order = 40")
+        const Size integrationOrder = 40;
+        const GaussLobattoQuadrature<double> quadrature(integrationOrder, comparison);
+        CIE_TEST_REQUIRE(quadrature.nodes().size() == integrationOrder);
+
+        // Exact for all even monomials up to degree 2 * integrationOrder - 4
+        for (Size exponent : {0ul, 2ul, 30ul, 76ul}) {
+            double integral = 0.0;
+            for (Size index=0; index<integrationOrder; ++index) {
+                integral += quadrature.weights()[index] * std::pow(quadrature.nodes()[index], double(exponent));
+            }
+            CIE_TEST_CHECK(integral == Approx(2.0 / (exponent + 1.0)).epsilon(1e-12));
+        }
+    }
+
+    {
+        CIE_TEST_CASE_INIT("float")
+        const GaussLobattoQuadrature<float> quadrature(8);
+        float weightSum = 0.0f;
+        for (const float weight : quadrature.weights()) weightSum += weight;
+        CIE_TEST_CHECK(weightSum == Approx(2.0f).epsilon(1e-6));
+    }
+}
+
+
+CIE_TEST_CASE("GaussLobattoQuadrature collocation", "[numeric]")
+{
+    CIE_TEST_CASE_INIT("GaussLobattoQuadrature collocation")
+
+    // Lagrange basis on the integration points
+    const GaussLobattoQuadrature<double> lobatto(4);
+    using Ansatz = maths::AnsatzSpace<maths::Polynomial<double>,2>;
+    Ansatz::AnsatzSet set;
+    for (Size iNode=0; iNode<lobatto.nodes().size(); ++iNode) {
+        set.push_back(maths::LagrangePolynomial<double>(lobatto.nodes().data(),
+                                                        lobatto.nodes().data() + lobatto.nodes().size(),
+                                                        iNode));
+    }
+    const Ansatz ansatzSpace(set);
+    const Quadrature<double,2> quadrature(lobatto);
+
+    DynamicArray<double> weights;
+    quadrature.getIntegrationWeights(std::back_inserter(weights));
+    CIE_TEST_REQUIRE(weights.size() == ansatzSpace.size());
+
+    // Integrate the mass matrix, whose integration points are ordered like the ansatz functions
+    const Size size = ansatzSpace.size();
+    DynamicArray<double> massMatrix(size * size, 0.0), values(size);
+    for (Size jNode=0; jNode<lobatto.nodes().size(); ++jNode) {
+        for (Size iNode=0; iNode<lobatto.nodes().size(); ++iNode) {
+            const StaticArray<double,2> point {lobatto.nodes()[iNode], lobatto.nodes()[jNode]};
+            const double weight = lobatto.weights()[iNode] * lobatto.weights()[jNode];
+            ansatzSpace.evaluate(point.data(), point.data() + point.size(), values.data());
+            for (Size iRow=0; iRow<size; ++iRow) {
+                for (Size iColumn=0; iColumn<size; ++iColumn) {
+                    massMatrix[iRow * size + iColumn] += weight * values[iRow] * values[iColumn];
+                }
+            }
+        }
+    }
+
+    for (Size iRow=0; iRow<size; ++iRow) {
+        for (Size iColumn=0; iColumn<size; ++iColumn) {
+            CIE_TEST_CHECK(massMatrix[iRow * size + iColumn] == Approx(iRow == iColumn ? weights[iRow] : 0.0).margin(1e-14));
+        }
+    }
+}
+
+
+} // namespace cie::fem
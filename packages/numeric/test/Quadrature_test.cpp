@@ -0,0 +1,93 @@
+// --- Utility Includes ---
+#include "packages/testing/inc/essentials.hpp"
+
+// --- FEM Includes ---
+#include "packages/numeric/inc/Quadrature.hpp"
+#include "packages/numeric/inc/GaussLegendreQuadrature.hpp"
+#include "packages/maths/inc/Polynomial.hpp"
+#include "packages/maths/inc/AnsatzSpace.hpp"
+#include "packages/maths/inc/LambdaExpression.hpp"
+
+// --- STL Includes ---
+#include <iterator> // back_inserter
+
+
+namespace cie::fem {
+
+
+CIE_TEST_CASE("Quadrature", "[numeric]")
+{
+    CIE_TEST_CASE_INIT("Quadrature")
+
+    const GaussLegendreQuadrature<double> base(3);
+    const Quadrature<double,2> quadrature(base);
+    CIE_TEST_REQUIRE(quadrature.pointCount() == 9u);
+    CIE_TEST_REQUIRE(quadrature.points().size() == 18u);
+    CIE_TEST_REQUIRE(quadrature.weights().size() == 9u);
+
+    {
+        CIE_TEST_CASE_INIT("layout")
+        DynamicArray<Quadrature<double,2>::Point> points;
+        DynamicArray<double> weights;
+        quadrature.getIntegrationPoints(std::back_inserter(points));
+        quadrature.getIntegrationWeights(std::back_inserter(weights));
+        CIE_TEST_REQUIRE(points.size() == quadrature.pointCount());
+        CIE_TEST_REQUIRE(weights.size() == quadrature.pointCount());
+
+        // The first index varies fastest
+        for (unsigned j=0u; j<3u; ++j) {
+            for (unsigned i=0u; i<3u; ++i) {
+                const unsigned iPoint = 3u * j + i;
+                CIE_TEST_CHECK(quadrature.points()[2 * iPoint] == base.nodes()[i]);
+                CIE_TEST_CHECK(quadrature.points()[2 * iPoint + 1] == base.nodes()[j]);
+                CIE_TEST_CHECK(points[iPoint][0] == base.nodes()[i]);
+                CIE_TEST_CHECK(points[iPoint][1] == base.nodes()[j]);
+                CIE_TEST_CHECK(quadrature.weights()[iPoint] == Approx(base.weights()[i] * base.weights()[j]));
+                CIE_TEST_CHECK(weights[iPoint] == quadrature.weights()[iPoint]);
+            }
+        }
+    }
+
+    {
+        CIE_TEST_CASE_INIT("block evaluation")
+
+        // Batched evaluation
+        using Basis = maths::Polynomial<double>;
+        const maths::AnsatzSpace<Basis,2> ansatzSpace(maths::AnsatzSpace<Basis,2>::AnsatzSet {
+            Basis({0.5, -0.5}),
+            Basis({0.5, 0.5}),
+            Basis({1.0, 0.0, -1.0})
+        });
+        DynamicArray<double> buffer(ansatzSpace.size());
+        DynamicArray<double> block(quadrature.pointCount() * ansatzSpace.size());
+        DynamicArray<double> reference(ansatzSpace.size()), result(ansatzSpace.size());
+        quadrature.evaluate(ansatzSpace, buffer.data(), reference.data());
+        quadrature.evaluateBlock(ansatzSpace, block.data(), result.data());
+        for (unsigned iComponent=0u; iComponent<result.size(); ++iComponent) {
+            CIE_TEST_CHECK(result[iComponent] == Approx(reference[iComponent]).margin(1e-14));
+        }
+
+        // Integrals of the linear functions are 1, and 4/3 for the bubble
+        CIE_TEST_CHECK(result[0] == Approx(1.0));
+        CIE_TEST_CHECK(result[2] == Approx(4.0 / 3.0));
+        CIE_TEST_CHECK(result[8] == Approx(16.0 / 9.0));
+
+        // Point-wise evaluation
+        const auto expression = maths::makeLambdaExpression<double>([] (Ptr<const double> itBegin,
+                                                                         Ptr<const double>,
+                                                                         Ptr<double> itOut) {
+            itOut[0] = 1.0;
+            itOut[1] = itBegin[0] * itBegin[0];
+            itOut[2] = itBegin[0] * itBegin[0] * itBegin[1] * itBegin[1];
+        }, 3);
+        block.resize(quadrature.pointCount() * expression.size());
+        result.resize(expression.size());
+        quadrature.evaluateBlock(expression, block.data(), result.data());
+        CIE_TEST_CHECK(result[0] == Approx(4.0));
+        CIE_TEST_CHECK(result[1] == Approx(4.0 / 3.0));
+        CIE_TEST_CHECK(result[2] == Approx(4.0 / 9.0));
+    }
+}
+
+
+} // namespace cie::fem
@@ -0,0 +1,143 @@
+// --- Utility Includes ---
+#include "packages/testing/inc/essentials.hpp"
+
+// --- FEM Includes ---
+#include "packages/numeric/inc/SumFactorization.hpp"
+#include "packages/numeric/inc/TabulationCache.hpp"
+#include "packages/numeric/inc/GaussLegendreQuadrature.hpp"
+#include "packages/maths/inc/AnsatzSpace.hpp"
+#include "packages/maths/inc/Polynomial.hpp"
+#include "packages/maths/inc/ScaleTranslateTransform.hpp"
+#include "packages/maths/inc/OrthogonalScaleTransform.hpp"
+
+// --- STL Includes ---
+#include <cmath> // sin
+
+
+namespace cie::fem {
+
+
+CIE_TEST_CASE("SumFactorization", "[numeric]")
+{
+    CIE_TEST_CASE_INIT("SumFactorization")
+    using Scalar = double;
+    using Basis = maths::Polynomial<Scalar>;
+    const DynamicArray<Basis> basisSet {
+        Basis({0.5, -0.5}),
+        Basis({0.5,  0.5}),
+        Basis({1.0,  0.0, -1.0})
+    };
+    const GaussLegendreQuadrature<Scalar> quadrature1D(3);
+
+    {
+        CIE_TEST_CASE_INIT("2D")
+        constexpr unsigned Dimension = 2u;
+        using Ansatz = maths::AnsatzSpace<Basis,Dimension>;
+        const Ansatz ansatzSpace(basisSet);
+        const SumFactorization<Ansatz> kernels(ansatzSpace, quadrature1D);
+        const unsigned size = kernels.size();
+        CIE_TEST_REQUIRE(size == 9u);
+
+        const StaticArray<StaticArray<Scalar,Dimension>,2> transformed {{{{1.0, -1.0}}, {{1.5, 1.0}}}};
+        const maths::ScaleTranslateTransform<Scalar,Dimension> transform(transformed.begin(), transformed.end());
+        StaticArray<Scalar,Dimension*Dimension> jacobian;
+        transform.makeDerivative().evaluate(nullptr, nullptr, jacobian.data());
+        const Scalar determinant = std::abs(jacobian[0] * jacobian[3]);
+
+        // Dense references integrated at the nodes of the tensor product quadrature
+        const Scalar density = 2.0, modulus = 3.0;
+        const Quadrature<Scalar,Dimension> quadrature(quadrature1D);
+        const AnsatzTabulation<Ansatz> tabulation(ansatzSpace, quadrature);
+        DynamicArray<Scalar> massReference(size * size, 0.0), stiffnessReference(size * size, 0.0);
+        for (unsigned iPoint=0u; iPoint<tabulation.pointCount(); ++iPoint) {
+            const Scalar weight = tabulation.getWeight(iPoint) * determinant;
+            const auto values = tabulation.getValues(iPoint);
+            const auto derivatives = tabulation.getDerivatives(iPoint);
+            for (unsigned iRow=0u; iRow<size; ++iRow) {
+                for (unsigned iColumn=0u; iColumn<size; ++iColumn) {
+                    massReference[iRow * size + iColumn] += weight * density * values[iRow] * values[iColumn];
+                    for (unsigned iAxis=0u; iAxis<Dimension; ++iAxis) {
+                        const Scalar scale = jacobian[iAxis * (Dimension + 1)];
+                        stiffnessReference[iRow * size + iColumn] += weight * modulus
+                                                                   * derivatives[iAxis * size + iRow]
+                                                                   * derivatives[iAxis * size + iColumn]
+                                                                   / (scale * scale);
+                    }
+                }
+            }
+        } // for iPoint in range(pointCount)
+
+        DynamicArray<Scalar> mass(size * size), stiffness(size * size);
+        CIE_TEST_CHECK_NOTHROW(kernels.computeMass(transform, density, mass.data()));
+        CIE_TEST_CHECK_NOTHROW(kernels.computeStiffness(transform, modulus, stiffness.data()));
+        for (unsigned iEntry=0u; iEntry<size*size; ++iEntry) {
+            CIE_TEST_CHECK(mass[iEntry] == Approx(massReference[iEntry]).margin(1e-12));
+            CIE_TEST_CHECK(stiffness[iEntry] == Approx(stiffnessReference[iEntry]).margin(1e-12));
+        }
+
+        DynamicArray<Scalar> input(size), massProduct(size), stiffnessProduct(size), buffer(kernels.getMinBufferSize());
+        for (unsigned iComponent=0u; iComponent<size; ++iComponent) input[iComponent] = std::sin(Scalar(iComponent + 1));
+        CIE_TEST_CHECK_NOTHROW(kernels.applyMass(transform, density, input.data(), massProduct.data(), {buffer.data(), buffer.size()}));
+        CIE_TEST_CHECK_NOTHROW(kernels.applyStiffness(transform, modulus, input.data(), stiffnessProduct.data(), {buffer.data(), buffer.size()}));
+        for (unsigned iRow=0u; iRow<size; ++iRow) {
+            Scalar massReferenceProduct = 0.0, stiffnessReferenceProduct = 0.0;
+            for (unsigned iColumn=0u; iColumn<size; ++iColumn) {
+                massReferenceProduct += massReference[iRow * size + iColumn] * input[iColumn];
+                stiffnessReferenceProduct += stiffnessReference[iRow * size + iColumn] * input[iColumn];
+            }
+            CIE_TEST_CHECK(massProduct[iRow] == Approx(massReferenceProduct).margin(1e-12));
+            CIE_TEST_CHECK(stiffnessProduct[iRow] == Approx(stiffnessReferenceProduct).margin(1e-12));
+        }
+    }
+
+    {
+        CIE_TEST_CASE_INIT("3D")
+        constexpr unsigned Dimension = 3u;
+        using Ansatz = maths::AnsatzSpace<Basis,Dimension>;
+        const Ansatz ansatzSpace(basisSet);
+        const SumFactorization<Ansatz> kernels(ansatzSpace, quadrature1D);
+        const unsigned size = kernels.size();
+        CIE_TEST_REQUIRE(size == 27u);
+
+        const StaticArray<StaticArray<Scalar,Dimension>,1> transformed {{{{0.5, 2.0, 1.5}}}};
+        const maths::OrthogonalScaleTransform<Scalar,Dimension> transform(transformed.begin(), transformed.end());
+
+        // Operator application must match the product with the formed matrices
+        DynamicArray<Scalar> mass(size * size), stiffness(size * size);
+        CIE_TEST_CHECK_NOTHROW(kernels.computeMass(transform, 1.0, mass.data()));
+        CIE_TEST_CHECK_NOTHROW(kernels.computeStiffness(transform, 1.0, stiffness.data()));
+
+        DynamicArray<Scalar> input(size), massProduct(size), stiffnessProduct(size), buffer(kernels.getMinBufferSize());
+        for (unsigned iComponent=0u; iComponent<size; ++iComponent) input[iComponent] = std::sin(Scalar(iComponent + 1));
+        CIE_TEST_CHECK_NOTHROW(kernels.applyMass(transform, 1.0, input.data(), massProduct.data(), {buffer.data(), buffer.size()}));
+        CIE_TEST_CHECK_NOTHROW(kernels.applyStiffness(transform, 1.0, input.data(), stiffnessProduct.data(), {buffer.data(), buffer.size()}));
+        for (unsigned iRow=0u; iRow<size; ++iRow) {
+            Scalar massReference = 0.0, stiffnessReference = 0.0;
+            for (unsigned iColumn=0u; iColumn<size; ++iColumn) {
+                massReference += mass[iRow * size + iColumn] * input[iColumn];
+                stiffnessReference += stiffness[iRow * size + iColumn] * input[iColumn];
+            }
+            CIE_TEST_CHECK(massProduct[iRow] == Approx(massReference).margin(1e-12));
+            CIE_TEST_CHECK(stiffnessProduct[iRow] == Approx(stiffnessReference).margin(1e-12));
+        }
+
+        // Constants are in the kernel of the stiffness operator, and the mass matrix integrates them to the cell's volume.
+        // The sum of the linear basis functions is 1 along each axis, so a constant is represented by ones at the
+        // DoFs that have no bubble component.
+        DynamicArray<Scalar> constant(size, 0.0);
+        for (unsigned iComponent=0u; iComponent<size; ++iComponent) {
+            constant[iComponent] = (iComponent % 3u != 2u && (iComponent / 3u) % 3u != 2u && iComponent / 9u != 2u) ? 1.0 : 0.0;
+        }
+        CIE_TEST_CHECK_NOTHROW(kernels.applyStiffness(transform, 1.0, constant.data(), stiffnessProduct.data(), {buffer.data(), buffer.size()}));
+        CIE_TEST_CHECK_NOTHROW(kernels.applyMass(transform, 1.0, constant.data(), massProduct.data(), {buffer.data(), buffer.size()}));
+        Scalar volume = 0.0;
+        for (unsigned iComponent=0u; iComponent<size; ++iComponent) {
+            CIE_TEST_CHECK(stiffnessProduct[iComponent] == Approx(0.0).margin(1e-12));
+            volume += constant[iComponent] * massProduct[iComponent];
+        }
+        CIE_TEST_CHECK(volume == Approx(8.0 * 0.5 * 2.0 * 1.5));
+    }
+}
+
+
+} // namespace cie::fem
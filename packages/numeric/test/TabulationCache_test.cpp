@@ -0,0 +1,142 @@
+// --- Utility Includes ---
+#include "packages/testing/inc/essentials.hpp"
+
+// --- FEM Includes ---
+#include "packages/numeric/inc/TabulationCache.hpp"
+#include "packages/numeric/inc/GaussLegendreQuadrature.hpp"
+#include "packages/maths/inc/AnsatzSpace.hpp"
+#include "packages/maths/inc/Polynomial.hpp"
+#include "packages/maths/inc/ScaleTranslateTransform.hpp"
+#include "packages/maths/inc/LinearIsotropicStiffnessIntegrand.hpp"
+#include "packages/maths/inc/TransformedIntegrand.hpp"
+
+// --- STL Includes ---
+#include <optional> // optional
+
+
+namespace cie::fem {
+
+
+CIE_TEST_CASE("TabulationCache", "[numeric]")
+{
+    CIE_TEST_CASE_INIT("TabulationCache")
+    using Scalar = double;
+    constexpr unsigned Dimension = 2u;
+
+    using Basis = maths::Polynomial<Scalar>;
+    using Ansatz = maths::AnsatzSpace<Basis,Dimension>;
+
+    const Ansatz ansatzSpace(Ansatz::AnsatzSet {
+        Basis({0.5, -0.5}),
+        Basis({0.5,  0.5}),
+        Basis({1.0,  0.0, -1.0})
+    });
+    const auto ansatzDerivatives = ansatzSpace.makeDerivative();
+    const Quadrature<Scalar,Dimension> quadrature((GaussLegendreQuadrature<Scalar>(3)));
+    const Quadrature<Scalar,Dimension> otherQuadrature((GaussLegendreQuadrature<Scalar>(4)));
+
+    TabulationCache<Ansatz> cache;
+    const auto pTabulation = cache.get(ansatzSpace, quadrature);
+    CIE_TEST_REQUIRE(pTabulation);
+    CIE_TEST_CHECK(cache.get(ansatzSpace, quadrature) == pTabulation);
+    CIE_TEST_CHECK(cache.size() == 1);
+    CIE_TEST_CHECK(cache.get(ansatzSpace, otherQuadrature) != pTabulation);
+    CIE_TEST_CHECK(cache.size() == 2);
+
+    CIE_TEST_REQUIRE(pTabulation->pointCount() == 9);
+    CIE_TEST_REQUIRE(pTabulation->ansatzCount() == 9);
+
+    // Copies of the ansatz space and of the quadrature share tabulations
+    {
+        CIE_TEST_CASE_INIT("identity")
+        const Ansatz ansatzCopy = ansatzSpace;
+        const Quadrature<Scalar,Dimension> quadratureCopy = quadrature;
+        CIE_TEST_CHECK(cache.get(ansatzCopy, quadrature) == pTabulation);
+        CIE_TEST_CHECK(cache.get(ansatzSpace, quadratureCopy) == pTabulation);
+        CIE_TEST_CHECK(cache.get(ansatzCopy, quadratureCopy) == pTabulation);
+        CIE_TEST_CHECK(cache.size() == 2);
+
+        // An equal but separately constructed basis is a different ansatz space
+        const Ansatz otherAnsatzSpace(ansatzSpace.ansatzSet());
+        CIE_TEST_CHECK(cache.get(otherAnsatzSpace, quadrature) != pTabulation);
+        CIE_TEST_CHECK(cache.size() == 3);
+    }
+
+    // Objects constructed in the storage of destroyed ones must not get stale tabulations
+    {
+        CIE_TEST_CASE_INIT("reused storage")
+        std::optional<Quadrature<Scalar,Dimension>> maybeQuadrature;
+        maybeQuadrature.emplace(GaussLegendreQuadrature<Scalar>(2));
+        CIE_TEST_CHECK(cache.get(ansatzSpace, maybeQuadrature.value())->pointCount() == 4);
+        maybeQuadrature.emplace(GaussLegendreQuadrature<Scalar>(5));
+        CIE_TEST_CHECK(cache.get(ansatzSpace, maybeQuadrature.value())->pointCount() == 25);
+
+        std::optional<Ansatz> maybeAnsatzSpace;
+        maybeAnsatzSpace.emplace(Ansatz::AnsatzSet {Basis({0.5, -0.5}), Basis({0.5, 0.5})});
+        CIE_TEST_CHECK(cache.get(maybeAnsatzSpace.value(), quadrature)->ansatzCount() == 4);
+        const std::size_t cacheSize = cache.size();
+        maybeAnsatzSpace.emplace(Ansatz::AnsatzSet {Basis({1.0})});
+        CIE_TEST_CHECK(cache.get(maybeAnsatzSpace.value(), quadrature)->ansatzCount() == 1);
+
+        // The tabulation of the destroyed ansatz space was discarded
+        CIE_TEST_CHECK(cache.size() == cacheSize);
+    }
+
+    // Tabulated values must match pointwise evaluation at the quadrature nodes
+    {
+        CIE_TEST_CASE_INIT("values")
+        DynamicArray<Quadrature<Scalar,Dimension>::Point> points;
+        DynamicArray<Scalar> weights;
+        quadrature.getIntegrationPoints(std::back_inserter(points));
+        quadrature.getIntegrationWeights(std::back_inserter(weights));
+        CIE_TEST_REQUIRE(points.size() == pTabulation->pointCount());
+
+        DynamicArray<Scalar> values(ansatzSpace.size()), derivatives(ansatzDerivatives.size());
+        for (unsigned iPoint=0u; iPoint<points.size(); ++iPoint) {
+            const auto point = pTabulation->getPoint(iPoint);
+            for (unsigned iDimension=0u; iDimension<Dimension; ++iDimension) {
+                CIE_TEST_CHECK(point[iDimension] == Approx(points[iPoint][iDimension]));
+            }
+            CIE_TEST_CHECK(pTabulation->getWeight(iPoint) == Approx(weights[iPoint]));
+
+            ansatzSpace.evaluate(point.data(), point.data() + point.size(), values.data());
+            ansatzDerivatives.evaluate(point.data(), point.data() + point.size(), derivatives.data());
+            const auto tabulatedValues = pTabulation->getValues(iPoint);
+            const auto tabulatedDerivatives = pTabulation->getDerivatives(iPoint);
+            CIE_TEST_REQUIRE(tabulatedValues.size() == values.size());
+            CIE_TEST_REQUIRE(tabulatedDerivatives.size() == derivatives.size());
+            for (unsigned i=0u; i<values.size(); ++i) CIE_TEST_CHECK(tabulatedValues[i] == Approx(values[i]));
+            for (unsigned i=0u; i<derivatives.size(); ++i) CIE_TEST_CHECK(tabulatedDerivatives[i] == Approx(derivatives[i]));
+        }
+    }
+
+    // Integrating from the tabulation must match integrating the transformed integrand
+    {
+        CIE_TEST_CASE_INIT("integrate")
+        const StaticArray<StaticArray<Scalar,Dimension>,2> transformed {{{{1.0, -1.0}}, {{1.5, 1.0}}}};
+        const maths::ScaleTranslateTransform<Scalar,Dimension> transform(transformed.begin(), transformed.end());
+        const auto jacobian = transform.makeDerivative();
+
+        const Scalar modulus = 3.0;
+        DynamicArray<Scalar> buffer(ansatzDerivatives.size());
+        const maths::LinearIsotropicStiffnessIntegrand<Ansatz::Derivative> integrand(modulus,
+                                                                                     ansatzDerivatives,
+                                                                                     {buffer.data(), buffer.size()});
+
+        DynamicArray<Scalar> reference(integrand.size()), result(integrand.size());
+        quadrature.evaluate(maths::makeTransformedIntegrand(
+            maths::LinearIsotropicStiffnessIntegrand<Ansatz::Derivative>(modulus,
+                                                                         ansatzDerivatives,
+                                                                         {buffer.data(), buffer.size()}),
+            jacobian
+        ), reference.data());
+        CIE_TEST_CHECK_NOTHROW(integrand.integrate(*pTabulation, jacobian, result.data()));
+
+        for (unsigned iEntry=0u; iEntry<result.size(); ++iEntry) {
+            CIE_TEST_CHECK(result[iEntry] == Approx(reference[iEntry]).margin(1e-12));
+        }
+    }
+}
+
+
+} // namespace cie::fem
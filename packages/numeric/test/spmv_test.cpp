@@ -0,0 +1,156 @@
+// --- Utility Includes ---
+#include "packages/testing/inc/essentials.hpp"
+#include "packages/stl_extension/inc/DynamicArray.hpp"
+
+// --- FEM Includes ---
+#include "packages/numeric/inc/spmv.hpp"
+
+// --- STL Includes ---
+#include <algorithm> // fill
+
+
+namespace cie::fem {
+
+
+CIE_TEST_CASE("spmv", "[numeric]")
+{
+    CIE_TEST_CASE_INIT("spmv")
+
+    /**
+     *  [ 4 -1  0  0  2 ]
+     *  [-1  4 -1  0  0 ]
+     *  [ 0 -1  4 -1  0 ]
+     *  [ 0  0 -1  4 -1 ]
+     *  [ 2  0  0 -1  4 ]
+     */
+    const DynamicArray<int> rowExtents {0, 3, 6, 9, 12, 15};
+    const DynamicArray<int> columnIndices {0, 1, 4,   0, 1, 2,   1, 2, 3,   2, 3, 4,   0, 3, 4};
+    const DynamicArray<double> nonzeros {4, -1, 2,   -1, 4, -1,   -1, 4, -1,   -1, 4, -1,   2, -1, 4};
+
+    const DynamicArray<int> upperRowExtents {0, 3, 5, 7, 9, 10};
+    const DynamicArray<int> upperColumnIndices {0, 1, 4,   1, 2,   2, 3,   3, 4,   4};
+    const DynamicArray<double> upperNonzeros {4, -1, 2,   4, -1,   4, -1,   4, -1,   4};
+
+    const DynamicArray<double> input {1, 2, 3, 4, 5};
+    const DynamicArray<double> reference {12, 4, 6, 8, 18};
+
+    {
+        CIE_TEST_CASE_INIT("general")
+        DynamicArray<double> output(input.size(), -1.0);
+        CIE_TEST_CHECK_NOTHROW(spmv(rowExtents, columnIndices, nonzeros, input.data(), output.data()));
+        for (std::size_t i=0ul; i<output.size(); ++i) {
+            CIE_TEST_CHECK(output[i] == Approx(reference[i]));
+        }
+    }
+
+    {
+        CIE_TEST_CASE_INIT("symmetric")
+        DynamicArray<double> output(input.size(), -1.0);
+        CIE_TEST_CHECK_NOTHROW(symmetricSpmv(upperRowExtents, upperColumnIndices, upperNonzeros, input.data(), output.data()));
+        for (std::size_t i=0ul; i<output.size(); ++i) {
+            CIE_TEST_CHECK(output[i] == Approx(reference[i]));
+        }
+    }
+
+    {
+        CIE_TEST_CASE_INIT("block")
+        // Expand each entry a of the scalar matrix into the block [[a, 0], [a, 2a]]
+        constexpr std::size_t blockSize = 2;
+        DynamicArray<double> blockNonzeros;
+        for (const double nonzero : nonzeros) {
+            blockNonzeros.insert(blockNonzeros.end(), {nonzero, 0.0, nonzero, 2.0 * nonzero});
+        }
+
+        DynamicArray<double> blockInput;
+        for (const double component : input) blockInput.insert(blockInput.end(), {component, -component});
+
+        DynamicArray<double> output(blockInput.size(), -1.0);
+        CIE_TEST_CHECK_NOTHROW(blockSpmv(blockSize, rowExtents, columnIndices, blockNonzeros, blockInput.data(), output.data()));
+        for (std::size_t i=0ul; i<reference.size(); ++i) {
+            CIE_TEST_CHECK(output[blockSize * i] == Approx(reference[i]));
+            CIE_TEST_CHECK(output[blockSize * i + 1] == Approx(-reference[i]));
+        }
+
+        mp::ThreadPoolBase threadPool(2);
+        std::fill(output.begin(), output.end(), -1.0);
+        CIE_TEST_CHECK_NOTHROW(blockSpmv(blockSize, rowExtents, columnIndices, blockNonzeros, blockInput.data(), output.data(), threadPool));
+        for (std::size_t i=0ul; i<reference.size(); ++i) {
+            CIE_TEST_CHECK(output[blockSize * i] == Approx(reference[i]));
+            CIE_TEST_CHECK(output[blockSize * i + 1] == Approx(-reference[i]));
+        }
+    }
+
+    {
+        CIE_TEST_CASE_INIT("parallel")
+        mp::ThreadPoolBase threadPool(2);
+        DynamicArray<double> output(input.size(), -1.0);
+
+        CIE_TEST_CHECK_NOTHROW(spmv(rowExtents, columnIndices, nonzeros, input.data(), output.data(), threadPool));
+        for (std::size_t i=0ul; i<output.size(); ++i) {
+            CIE_TEST_CHECK(output[i] == Approx(reference[i]));
+        }
+
+        std::fill(output.begin(), output.end(), -1.0);
+        CIE_TEST_CHECK_NOTHROW(symmetricSpmv(upperRowExtents, upperColumnIndices, upperNonzeros, input.data(), output.data(), threadPool));
+        for (std::size_t i=0ul; i<output.size(); ++i) {
+            CIE_TEST_CHECK(output[i] == Approx(reference[i]));
+        }
+    }
+
+    {
+        CIE_TEST_CASE_INIT("symmetric with buffer")
+        DynamicArray<double> output(input.size()), buffer;
+        for (const std::size_t threadCount : {1ul, 2ul, 3ul, 5ul, 8ul}) {
+            mp::ThreadPoolBase threadPool(threadCount);
+            for (unsigned iRepeat=0u; iRepeat<2u; ++iRepeat) {
+                std::fill(output.begin(), output.end(), -1.0);
+                CIE_TEST_CHECK_NOTHROW(symmetricSpmv(upperRowExtents, upperColumnIndices, upperNonzeros, input.data(), output.data(), buffer, threadPool));
+                for (std::size_t i=0ul; i<output.size(); ++i) {
+                    CIE_TEST_CHECK(output[i] == Approx(reference[i]));
+                }
+            }
+
+            // Accumulators only cover the rows after each chunk
+            CIE_TEST_CHECK(buffer.size() < threadCount * input.size());
+        }
+    }
+
+    {
+        CIE_TEST_CASE_INIT("symmetric banded")
+        // Pentadiagonal matrix: accumulators must only cover the band after each chunk
+        constexpr std::size_t rowCount = 1000ul;
+        constexpr std::size_t bandwidth = 2ul;
+        DynamicArray<int> bandRowExtents {0}, bandColumnIndices;
+        DynamicArray<double> bandNonzeros, bandInput(rowCount), bandReference(rowCount, 0.0);
+        for (std::size_t iRow=0ul; iRow<rowCount; ++iRow) {
+            bandInput[iRow] = 1.0 + static_cast<double>(iRow % 7);
+            for (std::size_t iColumn=iRow; iColumn<std::min(rowCount, iRow + bandwidth + 1); ++iColumn) {
+                const double nonzero = iColumn == iRow ? 6.0 : -1.0 / static_cast<double>(iColumn - iRow);
+                bandColumnIndices.push_back(static_cast<int>(iColumn));
+                bandNonzeros.push_back(nonzero);
+            }
+            bandRowExtents.push_back(static_cast<int>(bandColumnIndices.size()));
+        }
+        for (std::size_t iRow=0ul; iRow<rowCount; ++iRow) {
+            for (int iEntry=bandRowExtents[iRow]; iEntry<bandRowExtents[iRow + 1]; ++iEntry) {
+                const std::size_t iColumn = bandColumnIndices[iEntry];
+                bandReference[iRow] += bandNonzeros[iEntry] * bandInput[iColumn];
+                if (iColumn != iRow) bandReference[iColumn] += bandNonzeros[iEntry] * bandInput[iRow];
+            }
+        }
+
+        DynamicArray<double> output(rowCount), buffer;
+        for (const std::size_t threadCount : {3ul, 4ul, 8ul}) {
+            mp::ThreadPoolBase threadPool(threadCount);
+            buffer.clear();
+            CIE_TEST_CHECK_NOTHROW(symmetricSpmv(bandRowExtents, bandColumnIndices, bandNonzeros, bandInput.data(), output.data(), buffer, threadPool));
+            for (std::size_t i=0ul; i<rowCount; ++i) {
+                CIE_TEST_CHECK(output[i] == Approx(bandReference[i]));
+            }
+            CIE_TEST_CHECK(buffer.size() <= threadCount * bandwidth);
+        }
+    }
+}
+
+
+} // namespace cie::fem
@@ -19,6 +19,7 @@
 #include "packages/maths/inc/LambdaExpression.hpp"
 #include "packages/numeric/inc/GaussLegendreQuadrature.hpp"
 #include "packages/numeric/inc/Quadrature.hpp"
+#include "packages/numeric/inc/DirichletConstraints.hpp"
 
 // --- STL Includes ---
 #include <ranges> // ranges::iota
@@ -202,25 +203,12 @@ CIE_TEST_CASE("1D", "[systemTests]")
                 const auto keys = assembler.keys();
                 CIE_TEST_REQUIRE(std::find(keys.begin(), keys.end(), rCell.id()) != keys.end());
             }
-            const auto& rGlobalDofIndices = assembler[rCell.id()];
-            const unsigned localSystemSize = rCell.data().pAnsatzSpace->size();
-
-            for (unsigned iLocalRow=0u; iLocalRow<localSystemSize; ++iLocalRow) {
-                for (unsigned iLocalColumn=0u; iLocalColumn<localSystemSize; ++iLocalColumn) {
-                    CIE_TEST_REQUIRE(iLocalRow < rGlobalDofIndices.size());
-                    CIE_TEST_REQUIRE(iLocalColumn < rGlobalDofIndices.size());
-
-                    const auto iRowBegin = rowExtents[rGlobalDofIndices[iLocalRow]];
-                    const auto iRowEnd = rowExtents[rGlobalDofIndices[iLocalRow] + 1];
-                    const auto itColumnIndex = std::find(columnIndices.begin() + iRowBegin,
-                                                         columnIndices.begin() + iRowEnd,
-                                                         rGlobalDofIndices[iLocalColumn]);
-                    CIE_OUT_OF_RANGE_CHECK(itColumnIndex != columnIndices.begin() + iRowEnd)
-                    const auto iEntry = std::distance(columnIndices.begin(),
-                                                      itColumnIndex);
-                    nonzeros[iEntry] += integrandBuffer[iLocalRow * localSystemSize + iLocalColumn];
-                } // for iLocalColumn in range(ansatzBuffer.size)
-            } // for iLocalRow in range(ansatzBuffer.size)
+            CIE_TEST_REQUIRE(assembler[rCell.id()].size() == rCell.data().pAnsatzSpace->size());
+            assembler.assemble(rCell.id(),
+                               integrandBuffer.data(),
+                               rowExtents,
+                               columnIndices,
+                               nonzeros);
         } // for rCell in mesh.vertices
     }
 
@@ -291,29 +279,12 @@ CIE_TEST_CASE("1D", "[systemTests]")
     CIE_TEST_CHECK(iLeftmostDof.has_value());
     CIE_TEST_CHECK(iRightmostDof.has_value());
 
-    // Barbaric dirichlet conditions.
+    // Dirichlet conditions.
     DynamicArray<Scalar> rhs(rowCount, 0.0);
-    DynamicArray<std::pair<std::size_t,Scalar>> dirichletConditions;
-    dirichletConditions.emplace_back(iLeftmostDof.value(), 1.0);
-    dirichletConditions.emplace_back(iRightmostDof.value(), 0.0);
-
-    for (const auto& [iDof, value] : dirichletConditions) {
-        for (std::size_t iRow=0ul; iRow<static_cast<std::size_t>(rowCount); ++iRow) {
-            const std::size_t iEntryBegin = rowExtents[iRow];
-            const std::size_t iEntryEnd   = rowExtents[iRow + 1];
-            for (std::size_t iEntry=iEntryBegin; iEntry<iEntryEnd; ++iEntry) {
-                const std::size_t iColumn = columnIndices[iEntry];
-                if (iRow == iDof) {
-                    if (iRow == iColumn) nonzeros[iEntry] = 1.0;
-                    else nonzeros[iEntry] = 0.0;
-                } else if (iColumn == iDof) {
-                    rhs[iRow] -= value * nonzeros[iEntry];
-                    nonzeros[iEntry] = 0.0;
-                }
-            } // for iEntry in range(iEntryBegin, iEntryEnd)
-        } // for iRow in range(rowCount)
-        rhs[iDof] = value;
-    }
+    DirichletConstraints<Scalar> dirichletConditions(rowCount);
+    dirichletConditions.addConstraint(iLeftmostDof.value(), 1.0);
+    dirichletConditions.addConstraint(iRightmostDof.value(), 0.0);
+    dirichletConditions.apply(rowExtents, columnIndices, nonzeros, rhs.data());
 
     DynamicArray<Scalar> solution(rhs.size());
     {
@@ -18,10 +18,16 @@
 #include "packages/maths/inc/ScaleTranslateTransform.hpp"
 #include "packages/numeric/inc/GaussLegendreQuadrature.hpp"
 #include "packages/numeric/inc/Quadrature.hpp"
+#include "packages/numeric/inc/TabulationCache.hpp"
 #include "packages/io/inc/Graphviz.hpp"
 #include "packages/io/inc/GraphML.hpp"
 #include "packages/maths/inc/LinearIsotropicStiffnessIntegrand.hpp"
+#include "packages/maths/inc/LinearIsotropicStiffnessAction.hpp"
 #include "packages/maths/inc/TransformedIntegrand.hpp"
+#include "packages/graph/inc/MatrixFreeOperator.hpp"
+#include "packages/graph/inc/EigenMatrixFreeOperator.hpp"
+#include "packages/numeric/inc/spmv.hpp"
+#include "packages/numeric/inc/DirichletConstraints.hpp"
 
 // --- STL Includes ---
 #include <ranges> // ranges::iota
@@ -290,54 +296,80 @@ CIE_TEST_CASE("2D", "[systemTests]")
     // Compute element contributions and assemble them into the matrix
     {
         const Quadrature<Scalar,Dimension> quadrature((GaussLegendreQuadrature<Scalar>(integrationOrder)));
-        DynamicArray<Scalar> derivativeBuffer(mesh.data().ansatzDerivatives.front().size());
         DynamicArray<Scalar> integrandBuffer(std::pow(mesh.data().ansatzSpaces.front().size(), 2ul));
-        DynamicArray<Scalar> productBuffer(integrandBuffer.size());
+        TabulationCache<Ansatz> tabulationCache;
 
         for (Ref<const Mesh::Vertex> rCell : mesh.vertices()) {
             const auto& rAnsatzSpace        = mesh.data().ansatzSpaces[rCell.data().iAnsatz];
             const auto& rAnsatzDerivatives  = mesh.data().ansatzDerivatives[rCell.data().iAnsatz];
             const auto jacobian = rCell.data().spatialTransform.makeDerivative();
 
-            const auto localIntegrand = maths::makeTransformedIntegrand(
-                maths::LinearIsotropicStiffnessIntegrand<Ansatz::Derivative>(rCell.data().diffusivity,
-                                                                             rAnsatzDerivatives,
-                                                                             {derivativeBuffer.data(), derivativeBuffer.size()}),
-                jacobian
-            );
-            quadrature.evaluate(localIntegrand, integrandBuffer.data());
+            // Cells sharing an ansatz space share the basis evaluated at the quadrature nodes
+            const auto pTabulation = tabulationCache.get(rAnsatzSpace, quadrature);
+            maths::LinearIsotropicStiffnessIntegrand<Ansatz::Derivative>(rCell.data().diffusivity, rAnsatzDerivatives)
+                .integrate(*pTabulation, jacobian, integrandBuffer.data());
 
             {
                 const auto keys = assembler.keys();
                 CIE_TEST_REQUIRE(std::find(keys.begin(), keys.end(), rCell.id()) != keys.end());
             }
-            const auto& rGlobalDofIndices = assembler[rCell.id()];
-            const unsigned localSystemSize = rAnsatzSpace.size();
-
-            for (unsigned iLocalRow=0u; iLocalRow<localSystemSize; ++iLocalRow) {
-                for (unsigned iLocalColumn=0u; iLocalColumn<localSystemSize; ++iLocalColumn) {
-                    CIE_TEST_REQUIRE(iLocalRow < rGlobalDofIndices.size());
-                    CIE_TEST_REQUIRE(iLocalColumn < rGlobalDofIndices.size());
-
-                    const auto iRowBegin = rowExtents[rGlobalDofIndices[iLocalRow]];
-                    const auto iRowEnd = rowExtents[rGlobalDofIndices[iLocalRow] + 1];
-                    const auto itColumnIndex = std::find(columnIndices.begin() + iRowBegin,
-                                                         columnIndices.begin() + iRowEnd,
-                                                         rGlobalDofIndices[iLocalColumn]);
-                    CIE_OUT_OF_RANGE_CHECK(itColumnIndex != columnIndices.begin() + iRowEnd)
-                    const auto iEntry = std::distance(columnIndices.begin(),
-                                                      itColumnIndex);
-                    nonzeros[iEntry] += integrandBuffer[iLocalRow * localSystemSize + iLocalColumn];
-                } // for iLocalColumn in range(ansatzBuffer.size)
-            } // for iLocalRow in range(ansatzBuffer.size)
+            CIE_TEST_REQUIRE(assembler[rCell.id()].size() == rAnsatzSpace.size());
+            assembler.assemble(rCell.id(),
+                               integrandBuffer.data(),
+                               rowExtents,
+                               columnIndices,
+                               nonzeros);
         } // for rCell in mesh.vertices
     }
 
+    // Cell kernel of the matrix-free operator
+    const Quadrature<Scalar,Dimension> matrixFreeQuadrature((GaussLegendreQuadrature<Scalar>(integrationOrder)));
+    const std::size_t localSize = mesh.data().ansatzSpaces.front().size();
+    const std::size_t derivativeSize = mesh.data().ansatzDerivatives.front().size();
+
+    // Scratch: derivative buffer of the action + integrand buffer of the quadrature
+    const auto cellKernel = [&mesh, &matrixFreeQuadrature, localSize, derivativeSize](VertexID cellID,
+                                                                                      Ptr<const Scalar> pLocalInput,
+                                                                                      Ptr<Scalar> pLocalOutput,
+                                                                                      std::span<Scalar> buffer) -> void {
+        Ref<const Mesh::Vertex> rCell = mesh.find(cellID).value();
+        const auto jacobian = rCell.data().spatialTransform.makeDerivative();
+        const auto localIntegrand = maths::makeTransformedIntegrand(
+            maths::LinearIsotropicStiffnessAction<Ansatz::Derivative>(rCell.data().diffusivity,
+                                                                      mesh.data().ansatzDerivatives[rCell.data().iAnsatz],
+                                                                      {pLocalInput, localSize},
+                                                                      buffer.subspan(0, derivativeSize)),
+            jacobian
+        );
+        matrixFreeQuadrature.evaluate(localIntegrand, buffer.data() + derivativeSize, pLocalOutput);
+    };
+
+    mp::ThreadPoolBase threadPool(2);
+    const MatrixFreeOperator<Scalar> matrixFreeOperator(assembler,
+                                                        cellKernel,
+                                                        derivativeSize + localSize,
+                                                        threadPool);
+
+    // Check the matrix-free operator against the assembled matrix
+    {
+        CIE_TEST_REQUIRE(matrixFreeOperator.size() == static_cast<std::size_t>(rowCount));
+
+        DynamicArray<Scalar> input(rowCount), reference(rowCount), output(rowCount);
+        for (std::size_t iDoF=0ul; iDoF<input.size(); ++iDoF) input[iDoF] = std::sin(Scalar(iDoF));
+        spmv(rowExtents, columnIndices, nonzeros, input.data(), reference.data());
+        CIE_TEST_CHECK_NOTHROW(matrixFreeOperator.product(input.data(), output.data()));
+
+        for (std::size_t iDoF=0ul; iDoF<output.size(); ++iDoF) {
+            CIE_TEST_CHECK(output[iDoF] == Approx(reference[iDoF]).margin(1e-12));
+        }
+    }
+
     // Find DoFs to constrain:
     // 0) u(0, 0) = 0
     // 1) u(1, 0) = 1
     // 2) u(0, 1) = 2
     // 3) u(1, 1) = 3
+    DirichletConstraints<Scalar> dirichletConditions(rowCount);
     {
         StaticArray<std::optional<std::size_t>,4> iConstrainedDofs;
         utils::Comparison<Scalar> comparison(1e-8, 1e-6);
@@ -394,35 +426,77 @@ CIE_TEST_CASE("2D", "[systemTests]")
             }
         } // for rCell in mesh.vertices
 
-        // Barbaric imposition of dirichlet conditions.
+        // Impose dirichlet conditions.
         for (const auto maybeDofIndex : iConstrainedDofs) {
             CIE_TEST_REQUIRE(maybeDofIndex.has_value());
         }
 
-        DynamicArray<std::pair<std::size_t,Scalar>> dirichletConditions;
         for (unsigned iDof=0u; iDof<iConstrainedDofs.size(); ++iDof) {
-            dirichletConditions.emplace_back(iConstrainedDofs[iDof].value(), Scalar(iDof));
+            dirichletConditions.addConstraint(iConstrainedDofs[iDof].value(), Scalar(iDof));
         }
+    }
 
-        for (const auto& [iDof, value] : dirichletConditions) {
-            for (std::size_t iRow=0ul; iRow<static_cast<std::size_t>(rowCount); ++iRow) {
-                const std::size_t iEntryBegin = rowExtents[iRow];
-                const std::size_t iEntryEnd   = rowExtents[iRow + 1];
-                for (std::size_t iEntry=iEntryBegin; iEntry<iEntryEnd; ++iEntry) {
-                    const std::size_t iColumn = columnIndices[iEntry];
-                    if (iRow == iDof) {
-                        if (iRow == iColumn) nonzeros[iEntry] = 1.0;
-                        else nonzeros[iEntry] = 0.0;
-                    } else if (iColumn == iDof) {
-                        rhs[iRow] -= value * nonzeros[iEntry];
-                        nonzeros[iEntry] = 0.0;
-                    }
-                } // for iEntry in range(iEntryBegin, iEntryEnd)
-            } // for iRow in range(rowCount)
-            rhs[iDof] = value;
+    // Condensing the assembler restricts the matrix-free operator to free DoFs
+    Assembler condensed = assembler;
+    DynamicArray<Scalar> constrainedValues;
+    const std::size_t freeDoFCount = condensed.condense(dirichletConditions, constrainedValues);
+    const MatrixFreeOperator<Scalar> condensedOperator(condensed,
+                                                       cellKernel,
+                                                       derivativeSize + localSize,
+                                                       threadPool);
+    CIE_TEST_REQUIRE(condensedOperator.size() == freeDoFCount);
+    CIE_TEST_REQUIRE(freeDoFCount + 4ul == assembler.dofCount());
+
+    // Map condensed DoF indices to the original ones
+    DynamicArray<std::size_t> originalDoFs(condensed.dofCount());
+    for (const auto cellID : assembler.keys()) {
+        for (std::size_t iLocal=0ul; iLocal<assembler[cellID].size(); ++iLocal) {
+            originalDoFs[condensed[cellID][iLocal]] = assembler[cellID][iLocal];
+        }
+    }
+
+    {
+        // The condensed product is the free block of the full one
+        DynamicArray<Scalar> input(freeDoFCount), output(freeDoFCount);
+        DynamicArray<Scalar> fullInput(assembler.dofCount(), 0.0), fullOutput(assembler.dofCount());
+        for (std::size_t iDoF=0ul; iDoF<freeDoFCount; ++iDoF) {
+            input[iDoF] = std::cos(Scalar(iDoF));
+            fullInput[originalDoFs[iDoF]] = input[iDoF];
+        }
+        CIE_TEST_CHECK_NOTHROW(condensedOperator.product(input.data(), output.data()));
+        matrixFreeOperator.product(fullInput.data(), fullOutput.data());
+        for (std::size_t iDoF=0ul; iDoF<freeDoFCount; ++iDoF) {
+            CIE_TEST_CHECK(output[iDoF] == Approx(fullOutput[originalDoFs[iDoF]]).margin(1e-12));
+        }
+
+        // Lifting subtracts the free rows of the product with the prescribed values
+        std::fill(fullInput.begin(), fullInput.end(), 0.0);
+        for (std::size_t iConstrained=0ul; iConstrained<constrainedValues.size(); ++iConstrained) {
+            fullInput[originalDoFs[freeDoFCount + iConstrained]] = constrainedValues[iConstrained];
+        }
+        std::fill(output.begin(), output.end(), 1.0);
+        CIE_TEST_CHECK_NOTHROW(condensedOperator.liftConstraints(constrainedValues, output.data()));
+        matrixFreeOperator.product(fullInput.data(), fullOutput.data());
+        for (std::size_t iDoF=0ul; iDoF<freeDoFCount; ++iDoF) {
+            CIE_TEST_CHECK(output[iDoF] == Approx(1.0 - fullOutput[originalDoFs[iDoF]]).margin(1e-12));
+        }
+
+        // The diagonal matches the one of the assembled matrix
+        DynamicArray<Scalar> diagonal(freeDoFCount);
+        CIE_TEST_CHECK_NOTHROW(condensedOperator.diagonal(diagonal.data()));
+        for (std::size_t iDoF=0ul; iDoF<freeDoFCount; ++iDoF) {
+            const int iRow = static_cast<int>(originalDoFs[iDoF]);
+            const auto itBegin = columnIndices.begin() + rowExtents[iRow];
+            const auto itEnd = columnIndices.begin() + rowExtents[iRow + 1];
+            const auto itDiagonal = std::find(itBegin, itEnd, iRow);
+            CIE_TEST_REQUIRE(itDiagonal != itEnd);
+            CIE_TEST_CHECK(diagonal[iDoF] == Approx(nonzeros[std::distance(columnIndices.begin(), itDiagonal)]).margin(1e-12));
         }
     }
 
+    // Impose dirichlet conditions on the assembled system.
+    dirichletConditions.apply(rowExtents, columnIndices, nonzeros, rhs.data());
+
     // Solve the linear system.
     DynamicArray<Scalar> solution(rhs.size());
     {
@@ -447,6 +521,45 @@ CIE_TEST_CASE("2D", "[systemTests]")
         std::copy(x.begin(), x.end(), solution.begin());
     }
 
+    // Solve the condensed system with the matrix-free operator and compare.
+    {
+        DynamicArray<Scalar> reducedRhs(freeDoFCount, 0.0), reducedSolution(freeDoFCount);
+        condensedOperator.liftConstraints(constrainedValues, reducedRhs.data());
+
+        const EigenMatrixFreeOperator<Scalar> lhsAdaptor(condensedOperator);
+        Eigen::Map<Eigen::Matrix<Scalar,Eigen::Dynamic,1>> rhsAdaptor(reducedRhs.data(), reducedRhs.size(), 1);
+
+        Eigen::ConjugateGradient<EigenMatrixFreeOperator<Scalar>,Eigen::Lower|Eigen::Upper,MatrixFreeJacobiPreconditioner<Scalar>> solver;
+        solver.setMaxIterations(int(1e3));
+        solver.setTolerance(1e-10);
+
+        solver.compute(lhsAdaptor);
+        const Eigen::Matrix<Scalar,Eigen::Dynamic,1> x = solver.solve(rhsAdaptor);
+        CIE_TEST_REQUIRE(solver.info() == Eigen::Success);
+        std::copy(x.begin(), x.end(), reducedSolution.begin());
+
+        DynamicArray<Scalar> condensedSolution(condensed.dofCount()), mappedSolution(condensed.dofCount());
+        condensed.expand(reducedSolution.data(), constrainedValues, condensedSolution.data());
+        for (std::size_t iDoF=0ul; iDoF<condensedSolution.size(); ++iDoF) {
+            mappedSolution[originalDoFs[iDoF]] = condensedSolution[iDoF];
+        }
+
+        // The reference solution is only accurate up to the tolerance of its solver,
+        // so the matrix-free one is checked against the residual of the assembled system.
+        DynamicArray<Scalar> residual(rhs.size());
+        spmv(rowExtents, columnIndices, nonzeros, mappedSolution.data(), residual.data());
+        Scalar residualNorm = 0.0, rhsNorm = 0.0;
+        for (std::size_t iDoF=0ul; iDoF<rhs.size(); ++iDoF) {
+            residualNorm += (residual[iDoF] - rhs[iDoF]) * (residual[iDoF] - rhs[iDoF]);
+            rhsNorm += rhs[iDoF] * rhs[iDoF];
+        }
+        CIE_TEST_CHECK(std::sqrt(residualNorm) < 1e-8 * std::sqrt(rhsNorm));
+
+        for (std::size_t iDoF=0ul; iDoF<mappedSolution.size(); ++iDoF) {
+            CIE_TEST_CHECK(mappedSolution[iDoF] == Approx(solution[iDoF]).margin(5e-3));
+        }
+    }
+
 //    {
 //        std::ofstream file("lhs.mm");
 //        utils::io::MatrixMarket::Output io(file);
@@ -516,19 +629,25 @@ CIE_TEST_CASE("2D", "[systemTests]")
             const auto& rGlobalIndices = assembler[rCell.id()];
             const auto& rAnsatzSpace = mesh.data().ansatzSpaces[rCell.data().iAnsatz];
 
-            for (const auto& localCoordinates : localSamplePoints) {
+            // Evaluate the ansatz space at all sample points of the cell at once
+            const unsigned ansatzSize = rAnsatzSpace.size();
+            ansatzBuffer.resize(ansatzSize * localSamplePoints.size());
+            rAnsatzSpace.evaluateBatch(localSamplePoints.front().data(),
+                                       localSamplePoints.size(),
+                                       ansatzBuffer.data(),
+                                       maths::BatchLayout::PointMajor);
+
+            for (std::size_t iSample=0ul; iSample<localSamplePoints.size(); ++iSample) {
+                const auto& localCoordinates = localSamplePoints[iSample];
                 StaticArray<Scalar,Dimension> globalSamplePoint;
                 rCell.data().spatialTransform.evaluate(localCoordinates.data(),
                                                        localCoordinates.data() + localCoordinates.size(),
                                                        globalSamplePoint.data());
                 solutionSamples.emplace_back(globalSamplePoint, 0.0);
-                ansatzBuffer.resize(rAnsatzSpace.size());
-                rAnsatzSpace.evaluate(localCoordinates.data(),
-                                                    localCoordinates.data() + localCoordinates.size(),
-                                                    ansatzBuffer.data());
 
-                for (unsigned iFunction=0u; iFunction<ansatzBuffer.size(); ++iFunction) {
-                    solutionSamples.back().second += solution[rGlobalIndices[iFunction]] * ansatzBuffer[iFunction];
+                const Ptr<const Scalar> pAnsatzValues = ansatzBuffer.data() + iSample * ansatzSize;
+                for (unsigned iFunction=0u; iFunction<ansatzSize; ++iFunction) {
+                    solutionSamples.back().second += solution[rGlobalIndices[iFunction]] * pAnsatzValues[iFunction];
                 }
             }
         }